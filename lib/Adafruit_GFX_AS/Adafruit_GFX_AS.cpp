@@ -48,6 +48,9 @@ Minor bug fix 19/3/15
   #include "glcdfont.c"
 #endif
 
+// The row format tables, FontPages.h has the page format ones
+#ifndef LOAD_FONT_PAGES
+
 #ifdef LOAD_FONT2
   #include "Font16.h"
 #endif
@@ -68,11 +71,44 @@ Minor bug fix 19/3/15
   #include "Font72.h"
 #endif
 
+#endif // LOAD_FONT_PAGES
+
 #ifdef __AVR__
  #include <avr/pgmspace.h>
 #else
  #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 #endif
+#ifndef pgm_read_ptr
+ #define pgm_read_ptr(addr) (*(const void * const *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#endif
+
+// Reads glyph bytes out of flash a 32 bit word at a time.  The ESP8266 can
+// only read its flash in words, pgm_read_byte() fetches a whole one for
+// every byte.  Any address works, the page format fonts start their glyphs
+// on a word.  Little endian, as the ESP8266 and the AVR are.
+struct GlyphReader {
+  const uint8_t *p; // The next byte
+  uint32_t word;    // The rest of the word p is in, p's byte in bits 0-7
+  uint8_t left;     // Bytes in word
+
+  GlyphReader(const uint8_t *at): p(at), left(0) {}
+
+  uint8_t read(void) {
+    if (!left) {
+      uintptr_t a = (uintptr_t)p;
+      word = pgm_read_dword(a & ~(uintptr_t)3) >> ((a & 3) * 8);
+      left = 4 - (a & 3);
+    }
+    uint8_t b = word;
+    word >>= 8;
+    left--;
+    p++;
+    return b;
+  }
+};
 
 Adafruit_GFX_AS::Adafruit_GFX_AS(int16_t w, int16_t h):
   WIDTH(w), HEIGHT(h)
@@ -84,41 +120,19 @@ Adafruit_GFX_AS::Adafruit_GFX_AS(int16_t w, int16_t h):
   textsize  = 1;
   textcolor = textbgcolor = 0xFFFF;
   wrap      = true;
+  win_x0    = win_x1 = win_x = win_y = 0;
 }
 
-// Draw a circle outline
+// Draw a circle outline.  The octant points are drawn as the horizontal
+// runs they form near the top and bottom and the vertical runs near the
+// sides, one run per value of y.
 void Adafruit_GFX_AS::drawCircle(int16_t x0, int16_t y0, int16_t r,
     uint16_t color) {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
-
   drawPixel(x0  , y0+r, color);
   drawPixel(x0  , y0-r, color);
   drawPixel(x0+r, y0  , color);
   drawPixel(x0-r, y0  , color);
-
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-  
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
-  }
+  drawCircleHelper(x0, y0, r, 0xF, color);
 }
 
 void Adafruit_GFX_AS::drawCircleHelper( int16_t x0, int16_t y0,
@@ -128,6 +142,7 @@ void Adafruit_GFX_AS::drawCircleHelper( int16_t x0, int16_t y0,
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
+  int16_t xs    = 1; // first x of the run on this y
 
   while (x<y) {
     if (f >= 0) {
@@ -138,32 +153,40 @@ void Adafruit_GFX_AS::drawCircleHelper( int16_t x0, int16_t y0,
     x++;
     ddF_x += 2;
     f     += ddF_x;
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    } 
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
+    // flush the run when y changes on the next step or the loop ends
+    if (f >= 0 || x >= y) {
+      int16_t n = x - xs + 1;
+      if (cornername & 0x4) {
+        drawSpan(y0 + y, x0 + xs, x0 + x, color);
+        drawFastVLine(x0 + y, y0 + xs, n, color);
+      }
+      if (cornername & 0x2) {
+        drawSpan(y0 - y, x0 + xs, x0 + x, color);
+        drawFastVLine(x0 + y, y0 - x, n, color);
+      }
+      if (cornername & 0x8) {
+        drawFastVLine(x0 - y, y0 + xs, n, color);
+        drawSpan(y0 + y, x0 - x, x0 - xs, color);
+      }
+      if (cornername & 0x1) {
+        drawFastVLine(x0 - y, y0 - x, n, color);
+        drawSpan(y0 - y, x0 - x, x0 - xs, color);
+      }
+      xs = x + 1;
     }
   }
 }
 
 void Adafruit_GFX_AS::fillCircle(int16_t x0, int16_t y0, int16_t r,
 			      uint16_t color) {
-  drawFastVLine(x0, y0-r, 2*r+1, color);
-  fillCircleHelper(x0, y0, r, 3, 0, color);
+  fillArcs(x0, x0, y0, r, 0, color);
 }
 
-// Used to do circles and roundrects
+// Used to do circles and roundrects.  Column x0+c of a corner runs from
+// y0-h to y0+h+delta, so row y0-t (and y0+delta+t) covers every column
+// whose h is at least t.  The Bresenham steps give those widths directly,
+// (x,y) is h=y for column x and h=x for column y, and they are drawn as
+// horizontal spans.
 void Adafruit_GFX_AS::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     uint8_t cornername, int16_t delta, uint16_t color) {
 
@@ -172,6 +195,7 @@ void Adafruit_GFX_AS::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
+  int16_t lo, w = 0;
 
   while (x<y) {
     if (f >= 0) {
@@ -182,14 +206,66 @@ void Adafruit_GFX_AS::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     x++;
     ddF_x += 2;
     f     += ddF_x;
+    if (w == 0) w = y > x ? y : x; // widest, for the rows in the middle
 
+    // y only reaches 0 for r=1, then column x0 itself is part of it
+    lo = y ? 1 : 0;
     if (cornername & 0x1) {
-      drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
+      drawSpan(y0 - x, x0 + lo, x0 + y, color);
+      drawSpan(y0 + x + delta, x0 + lo, x0 + y, color);
+      if (f >= 0 || x >= y) {
+        drawSpan(y0 - y, x0 + lo, x0 + x, color);
+        drawSpan(y0 + y + delta, x0 + lo, x0 + x, color);
+      }
     }
     if (cornername & 0x2) {
-      drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
+      drawSpan(y0 - x, x0 - y, x0 - lo, color);
+      drawSpan(y0 + x + delta, x0 - y, x0 - lo, color);
+      if (f >= 0 || x >= y) {
+        drawSpan(y0 - y, x0 - x, x0 - lo, color);
+        drawSpan(y0 + y + delta, x0 - x, x0 - lo, color);
+      }
+    }
+  }
+  if (w) {
+    lo = (r == 1) ? 0 : 1;
+    for (int16_t i=0; i<=delta; i++) {
+      if (cornername & 0x1) drawSpan(y0 + i, x0 + lo, x0 + w, color);
+      if (cornername & 0x2) drawSpan(y0 + i, x0 - w, x0 - lo, color);
+    }
+  }
+}
+
+// Both halves of fillCircleHelper() with everything between columns xl and
+// xr, one span per row.  Rows y0..y0+delta are left to the caller.
+void Adafruit_GFX_AS::fillArcs(int16_t xl, int16_t xr, int16_t y0,
+    int16_t r, int16_t delta, uint16_t color) {
+
+  int16_t f     = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x     = 0;
+  int16_t y     = r;
+
+  if (delta == 0) drawSpan(y0, xl - r, xr + r, color);
+  while (x<y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f     += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f     += ddF_x;
+
+    // for r=1 the corners are the columns xl and xr themselves, which may
+    // be the wrong way round for a roundrect with w = 2
+    int16_t e = y ? y : (xl > xr);
+    drawSpan(y0 - x, xl - e, xr + e, color);
+    drawSpan(y0 + x + delta, xl - e, xr + e, color);
+    if ((f >= 0 || x >= y) && y != x && (y || delta >= 0)) {
+      drawSpan(y0 - y, xl - x, xr + x, color);
+      drawSpan(y0 + y + delta, xl - x, xr + x, color);
     }
   }
 }
@@ -258,6 +334,12 @@ void Adafruit_GFX_AS::drawFastHLine(int16_t x, int16_t y,
   drawLine(x, y, x+w-1, y, color);
 }
 
+void Adafruit_GFX_AS::drawSpan(int16_t y, int16_t x0, int16_t x1,
+			    uint16_t color) {
+  // Update in subclasses if desired!
+  drawFastHLine(x0, y, x1-x0+1, color);
+}
+
 void Adafruit_GFX_AS::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 			    uint16_t color) {
   // Update in subclasses if desired!
@@ -288,12 +370,9 @@ void Adafruit_GFX_AS::drawRoundRect(int16_t x, int16_t y, int16_t w,
 // Fill a rounded rectangle
 void Adafruit_GFX_AS::fillRoundRect(int16_t x, int16_t y, int16_t w,
 				 int16_t h, int16_t r, uint16_t color) {
-  // smarter version
-  fillRect(x+r, y, w-2*r, h, color);
-
-  // draw four corners
-  fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
-  fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+  // the straight part in one go, the rounded rows as full width spans
+  fillRect(x, y+r, w, h-2*r, color);
+  fillArcs(x+r, x+w-r-1, y+r, r, h-2*r-1, color);
 }
 
 // Draw a triangle
@@ -465,7 +544,7 @@ void Adafruit_GFX_AS::fillTriangle ( int16_t x0, int16_t y0,
     else if(x1 > b) b = x1;
     if(x2 < a)      a = x2;
     else if(x2 > b) b = x2;
-    drawFastHLine(a, y0, b-a+1, color);
+    drawSpan(y0, a, b, color);
     return;
   }
 
@@ -495,7 +574,7 @@ void Adafruit_GFX_AS::fillTriangle ( int16_t x0, int16_t y0,
     sb += dx02;
 
     if(a > b) swap(a,b);
-    drawFastHLine(a, y, b-a+1, color);
+    drawSpan(y, a, b, color);
   }
 
   // For lower part of triangle, find scanline crossings for segments
@@ -509,7 +588,7 @@ void Adafruit_GFX_AS::fillTriangle ( int16_t x0, int16_t y0,
     sb += dx02;
 
     if(a > b) swap(a,b);
-    drawFastHLine(a, y, b-a+1, color);
+    drawSpan(y, a, b, color);
   }
 }
 
@@ -551,6 +630,39 @@ void Adafruit_GFX_AS::write(uint8_t c) {
 #endif
 }
 
+#if ARDUINO >= 100
+size_t Adafruit_GFX_AS::write(const uint8_t *buffer, size_t size) {
+  const uint8_t *end = buffer + size;
+
+  while (buffer < end) {
+    if (*buffer == '\n') {
+      cursor_y += textsize*8;
+      cursor_x  = 0;
+      buffer++;
+    } else if (*buffer == '\r') {
+      // skip em
+      buffer++;
+    } else {
+      // one test for the line, then only the characters on the screen
+      boolean visible = (cursor_y < _height) && (cursor_y + textsize*8 > 0);
+      while (buffer < end && *buffer != '\n' && *buffer != '\r') {
+        if (visible && (cursor_x < _width) && (cursor_x + textsize*6 > 0))
+          drawChar(cursor_x, cursor_y, *buffer, textcolor, textbgcolor,
+            textsize);
+        buffer++;
+        cursor_x += textsize*6;
+        if (wrap && (cursor_x > (_width - textsize*6))) {
+          cursor_y += textsize*8;
+          cursor_x  = 0;
+          break;
+        }
+      }
+    }
+  }
+  return size;
+}
+#endif
+
 // Draw a character - only used for the original Adafruit font
 void Adafruit_GFX_AS::drawChar(int16_t x, int16_t y, unsigned char c,
 			    uint16_t color, uint16_t bg, uint8_t size) {
@@ -652,84 +764,42 @@ int Adafruit_GFX_AS::drawChar(unsigned int uniCode, int x, int y, int size)
 {
   unsigned int width = 0;
   unsigned int height = 0;
-  unsigned int flash_address = 0; // 16 bit address OK for Arduino if font files <60K
+  const uint8_t *flash_address = 0;
 
   int8_t gap = 0;
-  uniCode -= 32; // Not using info from font files at the moment
-
-  switch(size) {
-  #ifdef LOAD_GLCD
-    case 1:
-      drawChar(x, y,uniCode+32,textcolor, textbgcolor, textsize);
-      return 6*textsize;
-  #endif
-
-  #ifdef LOAD_FONT2
-    case 2:
-      flash_address = pgm_read_word(&chrtbl_f16[uniCode]);
-      width = pgm_read_byte(widtbl_f16+uniCode);
-      height = chr_hgt_f16;
-      gap = 1;
-      break;
-  #endif
-
-//    case 3:
-//      flash_address = pgm_read_word(&chrtbl_f24[uniCode]);
-//      width = pgm_read_byte(widtbl_f24+uniCode);
-//      height = chr_hgt_f24;
-//      gap = 0;
-//      break;
-
-  #ifdef LOAD_FONT4
-    case 4:
-      flash_address = pgm_read_word(&chrtbl_f32[uniCode]);
-      width = pgm_read_byte(widtbl_f32+uniCode);
-      height = chr_hgt_f32;
-      gap = -3;
-      break;
-  #endif
-
-//    case 5:
-//      flash_address = pgm_read_word(&chrtbl_f48[uniCode]);
-//      width = pgm_read_byte(widtbl_f48+uniCode);
-//      height = chr_hgt_f48;
-//      gap = -3;
-//      break;
-
-  #ifdef LOAD_FONT6
-    case 6:
-      flash_address = pgm_read_word(&chrtbl_f64[uniCode]);
-      width = pgm_read_byte(widtbl_f64+uniCode);
-      height = chr_hgt_f64;
-      gap = -3;
-      break;
-  #endif
 
-  #ifdef LOAD_FONT7
-    case 7:
-      flash_address = pgm_read_word(&chrtbl_f7s[uniCode]);
-      width = pgm_read_byte(widtbl_f7s+uniCode);
-      height = chr_hgt_f7s;
-      gap = 2;
-      break;
-  #endif
-
-  #ifdef LOAD_FONT8
-    case 8:
-      flash_address = pgm_read_word(&chrtbl_f72[uniCode]);
-      width = pgm_read_byte(widtbl_f72+uniCode);
-      height = chr_hgt_f72;
-      gap = 2;
-      break;
-  #endif
-
-    default:
-      return 0;
+#ifdef LOAD_GLCD
+  if (size == 1) {
+    drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
+    return 6*textsize;
   }
+#endif
+  if (!fontGlyph(uniCode, size, &flash_address, &width, &height, &gap))
+    return 0;
 
-if (x+(width+gap)*textsize >= _width) return (width+gap)*textsize ;
+// Unsigned, a glyph that ends left of the screen is skipped as well
+if (x+(width+gap)*textsize >= (unsigned int)_width) return (width+gap)*textsize ;
+
+#ifdef LOAD_FONT_PAGES
+if (textcolor == textbgcolor) {
+  drawGlyphPages(x, y, flash_address, width, height,
+    fontPages(size, &gap)->encoding, textcolor, textcolor, textsize);
+}
+else if (textsize != 1) {
+  fillRect(x, y, (width+gap)*textsize, height*textsize, textbgcolor);
+  drawGlyphPages(x, y, flash_address, width, height,
+    fontPages(size, &gap)->encoding, textcolor, textcolor, textsize);
+}
+else {
+  // The same box as the block write of the row format, whole bytes wide
+  drawGlyphPages(x, y, flash_address, width, height,
+    fontPages(size, &gap)->encoding, textcolor, textbgcolor, 1);
+  fillRect(x+width, y, ((width+7)&~7)-width, height, textbgcolor);
+}
+#else
 
 int w = (width+7)/8;
+GlyphReader glyph(flash_address);
 int pX      = 0;
 int pY      = y;
 byte line = 0;
@@ -743,7 +813,7 @@ if (textcolor == textbgcolor | textsize != 1) {
     }
     for (int k = 0;k < w; k++)
     { 
-      line = pgm_read_byte(flash_address+w*i+k);
+      line = glyph.read();
       if(line) {
         if (textsize==1){
           pX = x + k*8;
@@ -779,60 +849,258 @@ else
 
   writeBegin();
 
-  int t = textcolor;
-  int b = textbgcolor;
-
   for(int i=0; i<height; i++)
   {
     for (int k = 0;k < w; k++)
     { 
-    line = pgm_read_byte(flash_address+w*i+k);
-    pX = x + k*8;
-    if(line&0x80) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x40) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x20) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x10) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x8) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x4) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x2) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
-    if(line&0x1) {while(!(SPSR&_BV(SPIF)));SPDR=t>>8;while(!(SPSR&_BV(SPIF)));SPDR=t;}
-    else {while(!(SPSR&_BV(SPIF)));SPDR=b>>8;while(!(SPSR&_BV(SPIF)));SPDR=b;}
+    line = glyph.read();
+    pushBits(line, 8, textcolor, textbgcolor);
     }
-    pY+=textsize;
   }
-  while(!(SPSR&_BV(SPIF)));
   writeEnd();
 }
+#endif // LOAD_FONT_PAGES
 
 return (width+gap)*textsize;        // x +
 }
 
+/***************************************************************************************
+** Function name:           drawGlyphPages
+** Description:             draw a glyph in page format, see FontPages.h
+***************************************************************************************/
+void Adafruit_GFX_AS::drawGlyphPages(int16_t x, int16_t y, const uint8_t *glyph,
+    uint8_t w, uint8_t h, uint8_t encoding, uint16_t color, uint16_t bg,
+    uint8_t size)
+{
+  boolean opaque = color != bg;
+  GlyphReader data(glyph);
+
+  for (uint8_t top = 0; top < h; top += 8, y += 8*size) {
+    uint8_t rows = h-top < 8 ? h-top : 8;
+    for (uint8_t col = 0; col < w; ) {
+      uint8_t n = 1;
+      if (encoding == FONT_PAGES_RUNS) {
+        uint8_t code = data.read();
+        if (code & 0x80) n = (code & 0x7F) + 1;
+        else {
+          // A run of whole bytes, background is skipped unless opaque
+          n = (code & 0x3F) + 1;
+          if (code & 0x40) fillRect(x+col*size, y, n*size, rows*size, color);
+          else if (opaque) fillRect(x+col*size, y, n*size, rows*size, bg);
+          col += n;
+          continue;
+        }
+      }
+      // Bytes copied as they are, in runs of rows of the same colour
+      for (; n > 0; n--, col++) {
+        uint8_t line = data.read(), r, e;
+        for (r = 0; r < rows; r = e) {
+          uint8_t on = (line >> r) & 1;
+          for (e = r+1; e < rows && ((line >> e) & 1) == on; e++);
+          if (on || opaque)
+            fillRect(x+col*size, y+r*size, size, (e-r)*size, on ? color : bg);
+        }
+      }
+    }
+  }
+}
+
 /***************************************************************************************
 ** Function name:           Fast character drawing support functions
 ***************************************************************************************/
 
 void Adafruit_GFX_AS::setAddrWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-  // Do nothing, MUST be subclassed
+  // Remembered for the drawPixel() version of pushBits()
+  win_x0 = win_x = x0;
+  win_x1 = x1;
+  win_y  = y0;
 }
 
 void Adafruit_GFX_AS::writeBegin()
 {
-  // Do nothing, MUST be subclassed
+  // Nothing to do without a device to talk to
 } 
 
 void Adafruit_GFX_AS::writeEnd()
 {
-  // Do nothing, MUST be subclassed
+  // Nothing to do without a device to talk to
 } 
 
+void Adafruit_GFX_AS::pushBits(uint8_t bits, uint8_t count, uint16_t color,
+    uint16_t bg)
+{
+  for (; count > 0; count--, bits <<= 1) {
+    drawPixel(win_x, win_y, (bits & 0x80) ? color : bg);
+    if (++win_x > win_x1) {
+      win_x = win_x0;
+      win_y++;
+    }
+  }
+}
+
+
+/***************************************************************************************
+** Function name:           fontGlyph
+** Description:             look up a character in the font tables
+***************************************************************************************/
+boolean Adafruit_GFX_AS::fontGlyph(unsigned int c, int font, const uint8_t **address,
+    unsigned int *width, unsigned int *height, int8_t *gap)
+{
+#ifdef LOAD_FONT_PAGES
+  const FontPages *pages = fontPages(font, gap);
+  if (pages) {
+    if (c < pages->first || c - pages->first >= pages->count) return false;
+    c -= pages->first;
+    if (pages->map) {
+      c = pgm_read_byte(pages->map + c);
+      if (c == 0xFF) return false;
+    }
+    *address = pages->bitmap + pgm_read_word(pages->offsets + c);
+    *width = pgm_read_byte(pages->widths + c);
+    *height = pages->height;
+    return true;
+  }
+#endif
+  unsigned int uniCode = c - 32; // Not using info from font files at the moment
+
+  if (font != 1 && (c < 32 || uniCode >= 96)) return false;
+
+  switch(font) {
+  #ifdef LOAD_GLCD
+    case 1:
+      *address = 0;
+      *width = 5;
+      *height = 8;
+      *gap = 1;
+      return true;
+  #endif
+
+  #ifndef LOAD_FONT_PAGES
+  #ifdef LOAD_FONT2
+    case 2:
+      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f16[uniCode]);
+      *width = pgm_read_byte(widtbl_f16+uniCode);
+      *height = chr_hgt_f16;
+      *gap = 1;
+      return true;
+  #endif
+
+//    case 3:
+//      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f24[uniCode]);
+//      *width = pgm_read_byte(widtbl_f24+uniCode);
+//      *height = chr_hgt_f24;
+//      *gap = 0;
+//      return true;
+
+  #ifdef LOAD_FONT4
+    case 4:
+      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f32[uniCode]);
+      *width = pgm_read_byte(widtbl_f32+uniCode);
+      *height = chr_hgt_f32;
+      *gap = -3;
+      return true;
+  #endif
+
+//    case 5:
+//      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f48[uniCode]);
+//      *width = pgm_read_byte(widtbl_f48+uniCode);
+//      *height = chr_hgt_f48;
+//      *gap = -3;
+//      return true;
+
+  #ifdef LOAD_FONT6
+    case 6:
+      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f64[uniCode]);
+      *width = pgm_read_byte(widtbl_f64+uniCode);
+      *height = chr_hgt_f64;
+      *gap = -3;
+      return true;
+  #endif
+
+  #ifdef LOAD_FONT7
+    case 7:
+      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f7s[uniCode]);
+      *width = pgm_read_byte(widtbl_f7s+uniCode);
+      *height = chr_hgt_f7s;
+      *gap = 2;
+      return true;
+  #endif
+
+  #ifdef LOAD_FONT8
+    case 8:
+      *address = (const uint8_t *)pgm_read_ptr(&chrtbl_f72[uniCode]);
+      *width = pgm_read_byte(widtbl_f72+uniCode);
+      *height = chr_hgt_f72;
+      *gap = 2;
+      return true;
+  #endif
+  #endif // LOAD_FONT_PAGES
+  }
+  return false;
+}
+
+/***************************************************************************************
+** Function name:           fontPages
+** Description:             the page format tables of a font
+***************************************************************************************/
+const FontPages *Adafruit_GFX_AS::fontPages(int font, int8_t *gap)
+{
+  switch(font) {
+  #ifdef LOAD_FONT_PAGES
+  #ifdef LOAD_FONT2
+    case 2:
+      *gap = 1;
+      return &fontpages_f16;
+  #endif
+  #ifdef LOAD_FONT4
+    case 4:
+      *gap = -3;
+      return &fontpages_f32;
+  #endif
+  #ifdef LOAD_FONT6
+    case 6:
+      *gap = -3;
+      return &fontpages_f64;
+  #endif
+  #ifdef LOAD_FONT7
+    case 7:
+      *gap = 2;
+      return &fontpages_f7s;
+  #endif
+  #ifdef LOAD_FONT8
+    case 8:
+      *gap = 2;
+      return &fontpages_f72;
+  #endif
+  #endif // LOAD_FONT_PAGES
+  }
+  return 0;
+}
+
+/***************************************************************************************
+** Function name:           getTextBounds
+** Description:             measure a string as drawString() would draw it
+***************************************************************************************/
+void Adafruit_GFX_AS::getTextBounds(const char *string, int16_t x, int16_t y, int font,
+    int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+    const uint8_t *address;
+    unsigned int width, height = 0;
+    int8_t gap;
+    int len = 0;
+
+    while(*string)
+    {
+        if (fontGlyph((unsigned char)*string, font, &address, &width, &height, &gap))
+            len += width+gap;
+        string++;
+    }
+    *x1 = x;
+    *y1 = y;
+    *w = len > 0 ? len*textsize : 0;
+    *h = len > 0 ? height*textsize : 0;
+}
 
 /***************************************************************************************
 ** Function name:           drawNumber unsigned with size
@@ -840,7 +1108,7 @@ void Adafruit_GFX_AS::writeEnd()
 ***************************************************************************************/
 int Adafruit_GFX_AS::drawNumber(long long_num,int poX, int poY, int size)
 {
-    char tmp[12];
+    char tmp[21]; // A 64 bit long, on the host
     if (long_num < 0) sprintf(tmp, "%li", long_num);
     else sprintf(tmp, "%lu", long_num);
     return drawString(tmp, poX, poY, size);
@@ -858,7 +1126,7 @@ int Adafruit_GFX_AS::drawString(char *string, int poX, int poY, int size)
     {
         int xPlus = drawChar(*string, poX, poY, size);
         sumX += xPlus;
-        *string++;
+        string++;
         poX += xPlus;                            /* Move cursor right       */
     }
     return sumX;
@@ -870,52 +1138,15 @@ int Adafruit_GFX_AS::drawString(char *string, int poX, int poY, int size)
 ***************************************************************************************/
 int Adafruit_GFX_AS::drawCentreString(char *string, int dX, int poY, int size)
 {
-    int sumX = 0;
-    int len = 0;
-    char *pointer = string;
-    char ascii;
-
-    while(*pointer)
-    {
-        ascii = *pointer;
-
-#ifdef LOAD_GLCD
-        if (size==1)len += 6;
-#endif
-#ifdef LOAD_FONT2
-        if (size==2)len += 1+pgm_read_byte(widtbl_f16+ascii-32);
-#endif
-        //if (size==3)len += 1+pgm_read_byte(widtbl_f48+ascii-32)/2;
-#ifdef LOAD_FONT4
-        if (size==4)len += pgm_read_byte(widtbl_f32+ascii-32)-3;
-#endif
-        //if (size==5) len += pgm_read_byte(widtbl_f48+ascii-32)-3;
-#ifdef LOAD_FONT6
-        if (size==6) len += pgm_read_byte(widtbl_f64+ascii-32)-3;
-#endif
-#ifdef LOAD_FONT7
-        if (size==7) len += pgm_read_byte(widtbl_f7s+ascii-32)+2;
-#endif
-#ifdef LOAD_FONT8
-        if (size==8) len += pgm_read_byte(widtbl_f72+ascii-32)+2;
-#endif
+    int16_t x1, y1;
+    uint16_t w, h;
 
-        *pointer++;
-    }
-    len = len*textsize;
-    int poX = dX - len/2;
+    getTextBounds(string, dX, poY, size, &x1, &y1, &w, &h);
+    int poX = dX - w/2;
 
     if (poX < 0) poX = 0;
 
-    while(*string)
-    {
-      int xPlus = drawChar(*string, poX, poY, size);
-      sumX += xPlus;
-      *string++;
-      poX += xPlus;                  /* Move cursor right            */
-    }
-    
-    return sumX;
+    return drawString(string, poX, poY, size);
 }
 
 /***************************************************************************************
@@ -924,53 +1155,15 @@ int Adafruit_GFX_AS::drawCentreString(char *string, int dX, int poY, int size)
 ***************************************************************************************/
 int Adafruit_GFX_AS::drawRightString(char *string, int dX, int poY, int size)
 {
-    int sumX = 0;
-    int len = 0;
-    char *pointer = string;
-    char ascii;
-
-    while(*pointer)
-    {
-        ascii = *pointer;
-
-#ifdef LOAD_GLCD
-        if (size==1)len += 6;
-#endif
-#ifdef LOAD_FONT2
-        if (size==2)len += 1+pgm_read_byte(widtbl_f16+ascii-32);
-#endif
-        //if (size==3)len += 1+pgm_read_byte(widtbl_f48+ascii-32)/2;
-#ifdef LOAD_FONT4
-        if (size==4)len += pgm_read_byte(widtbl_f32+ascii-32)-3;
-#endif
-        //if (size==5) len += pgm_read_byte(widtbl_f48+ascii-32)-3;
-#ifdef LOAD_FONT6
-        if (size==6) len += pgm_read_byte(widtbl_f64+ascii-32)-3;
-#endif
-#ifdef LOAD_FONT7
-        if (size==7) len += pgm_read_byte(widtbl_f7s+ascii-32)+2;
-#endif
-#ifdef LOAD_FONT8
-        if (size==8) len += pgm_read_byte(widtbl_f72+ascii-32)+2;
-#endif
+    int16_t x1, y1;
+    uint16_t w, h;
 
-        *pointer++;
-    }
-    
-    len = len*textsize;
-    int poX = dX - len;
+    getTextBounds(string, dX, poY, size, &x1, &y1, &w, &h);
+    int poX = dX - w;
 
     if (poX < 0) poX = 0;
 
-    while(*string)
-    {
-      int xPlus = drawChar(*string, poX, poY, size);
-      sumX += xPlus;
-      *string++;
-      poX += xPlus;          /* Move cursor right            */
-    }
-    
-    return sumX;
+    return drawString(string, poX, poY, size);
 }
 
 /***************************************************************************************
@@ -2,6 +2,7 @@
 #define _ADAFRUIT_GFX_AS_H
 
 #include "Load_fonts.h"
+#include "FontPages.h"
 
 #if ARDUINO >= 100
  #include "Arduino.h"
@@ -20,10 +21,19 @@ class Adafruit_GFX_AS : public Print {
 
   // These MUST be defined by the subclass:
   virtual void
-    drawPixel(int16_t x, int16_t y, uint16_t color) = 0,
+    drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  // Block writes, opaque text at size 1 draws through these.  A window is
+  // set, then filled row by row between writeBegin() and writeEnd(), each
+  // pushBits() call takes the next count (up to 8) pixels, MSB first, as
+  // color for a 1 bit and bg for a 0 bit.  The default setAddrWindow()
+  // keeps the window in win_x0..win_y, the default pushBits() walks it with
+  // drawPixel().
+  virtual void
     setAddrWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1),
     writeBegin(void),
-    writeEnd(void);
+    writeEnd(void),
+    pushBits(uint8_t bits, uint8_t count, uint16_t color, uint16_t bg);
 
   // These MAY be overridden by the subclass to provide device-specific
   // optimized code.  Otherwise 'generic' versions are used.
@@ -34,6 +44,9 @@ class Adafruit_GFX_AS : public Print {
     drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillScreen(uint16_t color),
+    // Horizontal run of pixels x0..x1 on row y, the fill primitives draw
+    // through this.  The default is drawFastHLine().
+    drawSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color),
     drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       uint16_t bg, uint8_t size),
     invertDisplay(boolean i);
@@ -71,8 +84,18 @@ class Adafruit_GFX_AS : public Print {
     int drawRightString(char *string, int dX, int poY, int size);
     int drawFloat(float floatNumber,int decimal,int poX, int poY, int size);
 
+  // The box drawString() would cover with font at the current text size,
+  // without drawing.  x1,y1 is the top left corner, an empty string or a
+  // font that isn't loaded is 0 wide and high.
+  void getTextBounds(const char *string, int16_t x, int16_t y, int font,
+      int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
+  // A whole string at a time: lines and wrap points are laid out first,
+  // lines and characters off the screen are skipped without drawChar().
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
 #else
   virtual void   write(uint8_t);
 #endif
@@ -84,11 +107,30 @@ class Adafruit_GFX_AS : public Print {
   uint8_t getRotation(void);
 
  protected:
+  // fillCircleHelper() for both corners joined across columns xl..xr
+  void fillArcs(int16_t xl, int16_t xr, int16_t y0, int16_t r,
+      int16_t delta, uint16_t color);
+  // Character c of font: the address of its bitmap, its width and height
+  // and the gap to the next one, unscaled.  False for a font that isn't
+  // loaded or a character it doesn't have.
+  boolean fontGlyph(unsigned int c, int font, const uint8_t **address,
+      unsigned int *width, unsigned int *height, int8_t *gap);
+  // The page format tables of font and its gap, null when it isn't loaded
+  // in page format (LOAD_FONT_PAGES).
+  const FontPages *fontPages(int font, int8_t *gap);
+  // A w x h glyph in page format (FontPages.h) scaled by size: color for
+  // its pixels, bg for the rest unless they are the same.  The default
+  // fills runs of rows and skips the background runs of transparent text.
+  virtual void drawGlyphPages(int16_t x, int16_t y, const uint8_t *glyph,
+      uint8_t w, uint8_t h, uint8_t encoding, uint16_t color, uint16_t bg,
+      uint8_t size);
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
     _width, _height, // Display w/h as modified by current rotation
-    cursor_x, cursor_y;
+    cursor_x, cursor_y,
+    win_x0, win_x1, win_x, win_y; // The default setAddrWindow() window
   uint16_t
     textcolor, textbgcolor;
   uint8_t
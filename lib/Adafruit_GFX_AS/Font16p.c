@@ -0,0 +1,239 @@
+// Font16.c in page format, made by tools/fontconv.py.
+// Don't edit, change Font16.c and run the tool again.
+
+#include "FontPages.h"
+#include <avr/pgmspace.h>
+
+PROGMEM const unsigned char widtbl_f16p[96] =
+{
+        5, 2, 3, 8, 7, 8, 8, 2,
+        6, 6, 7, 5, 2, 5, 4, 6,
+        7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 2, 2, 5, 5, 5, 7,
+        8, 7, 7, 7, 7, 7, 7, 7,
+        6, 3, 7, 7, 6, 9, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 9,
+        7, 7, 7, 3, 6, 3, 7, 8,
+        3, 6, 6, 6, 6, 6, 5, 6,
+        6, 4, 4, 5, 4, 7, 6, 7,
+        6, 7, 5, 5, 4, 6, 7, 7,
+        5, 6, 6, 4, 2, 4, 7, 5
+};
+
+PROGMEM const unsigned short offtbl_f16p[96] =
+{
+        0, 12, 16, 24, 40, 56, 72, 88,
+        92, 104, 116, 132, 144, 148, 160, 168,
+        180, 196, 212, 228, 244, 260, 276, 292,
+        308, 324, 340, 344, 348, 360, 372, 384,
+        400, 416, 432, 448, 464, 480, 496, 512,
+        528, 540, 548, 564, 580, 592, 612, 628,
+        644, 660, 676, 692, 708, 724, 740, 756,
+        776, 792, 808, 824, 168, 832, 840, 856,
+        872, 880, 892, 904, 916, 928, 940, 952,
+        964, 976, 984, 992, 1004, 1012, 1028, 1040,
+        1056, 1068, 1084, 1096, 1108, 1116, 1128, 1144,
+        1160, 1172, 1184, 1196, 1204, 1208, 1216, 1232
+};
+
+PROGMEM const unsigned char pagtbl_f16p[1244] FONT_PAGES_ALIGN =
+{
+        // 0x20, 5 columns
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x21, 2 columns
+        0x00, 0xF8, 0x00, 0x17,
+        // 0x22, 3 columns
+        0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x23, 8 columns
+        0x40, 0x40, 0xF8, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x02, 0x02, 0x1F, 0x02, 0x02, 0x1F, 0x02, 0x02,
+        // 0x24, 7 columns
+        0x00, 0xF0, 0x88, 0x88, 0x08, 0x08, 0x10, 0x10, 0x1F, 0x12, 0x12, 0x10, 0x10, 0x10, 0x00, 0x00,
+        // 0x25, 8 columns
+        0x30, 0x48, 0x48, 0x30, 0x80, 0x40, 0x20, 0x18, 0x18, 0x04, 0x02, 0x01, 0x0C, 0x12, 0x12, 0x0C,
+        // 0x26, 8 columns
+        0x60, 0x90, 0x08, 0x90, 0x60, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x11, 0x12, 0x0C, 0x0C, 0x12, 0x10,
+        // 0x27, 2 columns
+        0x20, 0x1C, 0x00, 0x00,
+        // 0x28, 6 columns
+        0xC0, 0x30, 0x08, 0x04, 0x02, 0x02, 0x07, 0x18, 0x20, 0x40, 0x80, 0x80,
+        // 0x29, 6 columns
+        0x02, 0x02, 0x04, 0x08, 0x30, 0xC0, 0x80, 0x80, 0x40, 0x20, 0x18, 0x07,
+        // 0x2A, 7 columns
+        0x20, 0x40, 0x80, 0xF0, 0x80, 0x40, 0x20, 0x02, 0x01, 0x00, 0x07, 0x00, 0x01, 0x02, 0x00, 0x00,
+        // 0x2B, 5 columns
+        0x00, 0x00, 0xC0, 0x00, 0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x00, 0x00,
+        // 0x2C, 2 columns
+        0x00, 0x00, 0x58, 0x38,
+        // 0x2D, 5 columns
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+        // 0x2E, 4 columns
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00,
+        // 0x2F, 6 columns
+        0x00, 0x00, 0x00, 0xC0, 0x30, 0x0C, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00,
+        // 0x30, 7 columns
+        0xC0, 0x30, 0x08, 0x08, 0x08, 0x30, 0xC0, 0x03, 0x0C, 0x10, 0x10, 0x10, 0x0C, 0x03, 0x00, 0x00,
+        // 0x31, 7 columns
+        0x00, 0x20, 0x10, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x10, 0x10, 0x00, 0x00, 0x00,
+        // 0x32, 7 columns
+        0x20, 0x10, 0x08, 0x08, 0x08, 0x90, 0x60, 0x18, 0x14, 0x12, 0x11, 0x11, 0x10, 0x10, 0x00, 0x00,
+        // 0x33, 7 columns
+        0x10, 0x08, 0x88, 0x88, 0x88, 0x50, 0x20, 0x08, 0x10, 0x10, 0x10, 0x10, 0x09, 0x06, 0x00, 0x00,
+        // 0x34, 7 columns
+        0x00, 0x80, 0x40, 0x20, 0x10, 0xF8, 0x00, 0x03, 0x02, 0x02, 0x02, 0x02, 0x1F, 0x02, 0x00, 0x00,
+        // 0x35, 7 columns
+        0xF8, 0x88, 0x88, 0x88, 0x88, 0x08, 0x00, 0x08, 0x10, 0x10, 0x10, 0x10, 0x09, 0x06, 0x00, 0x00,
+        // 0x36, 7 columns
+        0xE0, 0x10, 0x88, 0x88, 0x88, 0x08, 0x00, 0x07, 0x09, 0x10, 0x10, 0x10, 0x09, 0x06, 0x00, 0x00,
+        // 0x37, 7 columns
+        0x00, 0x08, 0x08, 0x08, 0x08, 0xC8, 0x38, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00,
+        // 0x38, 7 columns
+        0x20, 0x50, 0x88, 0x88, 0x88, 0x50, 0x20, 0x06, 0x09, 0x10, 0x10, 0x10, 0x09, 0x06, 0x00, 0x00,
+        // 0x39, 7 columns
+        0x60, 0x90, 0x08, 0x08, 0x08, 0x90, 0xE0, 0x00, 0x10, 0x11, 0x11, 0x11, 0x08, 0x07, 0x00, 0x00,
+        // 0x3A, 2 columns
+        0xC0, 0xC0, 0x06, 0x06,
+        // 0x3B, 2 columns
+        0xC0, 0xC0, 0x16, 0x0E,
+        // 0x3C, 5 columns
+        0x00, 0x80, 0x40, 0x20, 0x10, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
+        // 0x3D, 5 columns
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+        // 0x3E, 5 columns
+        0x10, 0x20, 0x40, 0x80, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,
+        // 0x3F, 7 columns
+        0x20, 0x10, 0x08, 0x08, 0x08, 0x90, 0x60, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00,
+        // 0x40, 8 columns
+        0xE0, 0x10, 0xC8, 0x28, 0x28, 0xC8, 0x10, 0xE0, 0x07, 0x08, 0x13, 0x14, 0x14, 0x17, 0x14, 0x03,
+        // 0x41, 7 columns
+        0x00, 0x80, 0x60, 0x18, 0x60, 0x80, 0x00, 0x1C, 0x03, 0x02, 0x02, 0x02, 0x03, 0x1C, 0x00, 0x00,
+        // 0x42, 7 columns
+        0xF8, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x09, 0x06, 0x00, 0x00,
+        // 0x43, 7 columns
+        0xE0, 0x10, 0x08, 0x08, 0x08, 0x08, 0x10, 0x07, 0x08, 0x10, 0x10, 0x10, 0x10, 0x08, 0x00, 0x00,
+        // 0x44, 7 columns
+        0xF8, 0x08, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00, 0x00,
+        // 0x45, 7 columns
+        0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x08, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+        // 0x46, 7 columns
+        0xF8, 0x88, 0x88, 0x88, 0x88, 0x08, 0x08, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x47, 7 columns
+        0xE0, 0x10, 0x08, 0x08, 0x08, 0x08, 0x10, 0x07, 0x08, 0x10, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00,
+        // 0x48, 6 columns
+        0xF8, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        // 0x49, 3 columns
+        0x08, 0xF8, 0x08, 0x10, 0x1F, 0x10, 0x00, 0x00,
+        // 0x4A, 7 columns
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x08, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00, 0x00,
+        // 0x4B, 7 columns
+        0xF8, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x1F, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
+        // 0x4C, 6 columns
+        0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10,
+        // 0x4D, 9 columns
+        0xF8, 0x18, 0x60, 0x80, 0x00, 0x80, 0x60, 0x18, 0xF8, 0x1F, 0x00, 0x00, 0x01, 0x06, 0x01, 0x00,
+        0x00, 0x1F, 0x00, 0x00,
+        // 0x4E, 7 columns
+        0xF8, 0x18, 0x60, 0x80, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x01, 0x06, 0x18, 0x1F, 0x00, 0x00,
+        // 0x4F, 7 columns
+        0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00, 0x00,
+        // 0x50, 7 columns
+        0xF8, 0x08, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x1F, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,
+        // 0x51, 7 columns
+        0xE0, 0x10, 0x08, 0x08, 0x08, 0x10, 0xE0, 0x07, 0x08, 0x10, 0x10, 0x30, 0x48, 0x47, 0x00, 0x00,
+        // 0x52, 7 columns
+        0xF8, 0x08, 0x08, 0x08, 0x08, 0x90, 0x60, 0x1F, 0x01, 0x01, 0x03, 0x05, 0x08, 0x10, 0x00, 0x00,
+        // 0x53, 7 columns
+        0x60, 0x90, 0x88, 0x08, 0x08, 0x10, 0x20, 0x04, 0x08, 0x10, 0x11, 0x11, 0x09, 0x06, 0x00, 0x00,
+        // 0x54, 7 columns
+        0x08, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x55, 7 columns
+        0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00, 0x00,
+        // 0x56, 7 columns
+        0x78, 0x80, 0x00, 0x00, 0x00, 0x80, 0x78, 0x00, 0x01, 0x06, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00,
+        // 0x57, 9 columns
+        0xF8, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x07, 0x18, 0x06, 0x01, 0x06, 0x18,
+        0x07, 0x00, 0x00, 0x00,
+        // 0x58, 7 columns
+        0x18, 0x20, 0x40, 0x80, 0x40, 0x20, 0x18, 0x18, 0x04, 0x02, 0x01, 0x02, 0x04, 0x18, 0x00, 0x00,
+        // 0x59, 7 columns
+        0x38, 0x40, 0x80, 0x00, 0x80, 0x40, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5A, 7 columns
+        0x08, 0x08, 0x08, 0x88, 0x48, 0x28, 0x18, 0x18, 0x14, 0x12, 0x11, 0x10, 0x10, 0x10, 0x00, 0x00,
+        // 0x5B, 3 columns
+        0xFC, 0x04, 0x04, 0x3F, 0x20, 0x20, 0x00, 0x00,
+        // 0x5D, 3 columns
+        0x04, 0x04, 0xFC, 0x20, 0x20, 0x3F, 0x00, 0x00,
+        // 0x5E, 7 columns
+        0x00, 0x08, 0x04, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x5F, 8 columns
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+        // 0x60, 3 columns
+        0x00, 0x38, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x61, 6 columns
+        0x00, 0x40, 0x40, 0x40, 0x80, 0x00, 0x0C, 0x12, 0x12, 0x12, 0x0C, 0x1F,
+        // 0x62, 6 columns
+        0xF0, 0x80, 0x40, 0x40, 0x80, 0x00, 0x1F, 0x08, 0x10, 0x10, 0x08, 0x07,
+        // 0x63, 6 columns
+        0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08,
+        // 0x64, 6 columns
+        0x00, 0x80, 0x40, 0x40, 0x80, 0xF0, 0x07, 0x08, 0x10, 0x10, 0x08, 0x1F,
+        // 0x65, 6 columns
+        0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x07, 0x0A, 0x12, 0x12, 0x12, 0x09,
+        // 0x66, 5 columns
+        0x00, 0xF0, 0x08, 0x08, 0x10, 0x01, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00,
+        // 0x67, 6 columns
+        0x00, 0x80, 0x40, 0x40, 0x80, 0x80, 0x07, 0x88, 0x90, 0x90, 0x48, 0x3F,
+        // 0x68, 6 columns
+        0xF8, 0x80, 0x40, 0x40, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        // 0x69, 4 columns
+        0x00, 0xD0, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+        // 0x6A, 4 columns
+        0x00, 0x00, 0x40, 0xD0, 0x40, 0x80, 0x80, 0x7F,
+        // 0x6B, 5 columns
+        0xF8, 0x00, 0x00, 0x80, 0x40, 0x1F, 0x02, 0x05, 0x08, 0x10, 0x00, 0x00,
+        // 0x6C, 4 columns
+        0x08, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00,
+        // 0x6D, 7 columns
+        0xC0, 0x80, 0x40, 0x80, 0x40, 0x40, 0x80, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+        // 0x6E, 6 columns
+        0xC0, 0x80, 0x40, 0x40, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        // 0x6F, 7 columns
+        0x00, 0x80, 0x40, 0x40, 0x40, 0x80, 0x00, 0x07, 0x08, 0x10, 0x10, 0x10, 0x08, 0x07, 0x00, 0x00,
+        // 0x70, 6 columns
+        0xC0, 0x80, 0x40, 0x40, 0x80, 0x00, 0xFF, 0x08, 0x10, 0x10, 0x08, 0x07,
+        // 0x71, 7 columns
+        0x00, 0x80, 0x40, 0x40, 0x80, 0xC0, 0x00, 0x07, 0x08, 0x10, 0x10, 0x08, 0xFF, 0x80, 0x00, 0x00,
+        // 0x72, 5 columns
+        0xC0, 0x80, 0x40, 0x40, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x73, 5 columns
+        0x80, 0x40, 0x40, 0x40, 0x80, 0x09, 0x12, 0x12, 0x12, 0x0C, 0x00, 0x00,
+        // 0x74, 4 columns
+        0x40, 0xF0, 0x40, 0x00, 0x00, 0x0F, 0x10, 0x10,
+        // 0x75, 6 columns
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x08, 0x10, 0x10, 0x08, 0x1F,
+        // 0x76, 7 columns
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x04, 0x08, 0x10, 0x08, 0x04, 0x03, 0x00, 0x00,
+        // 0x77, 7 columns
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x10, 0x08, 0x06, 0x08, 0x10, 0x0F, 0x00, 0x00,
+        // 0x78, 5 columns
+        0xC0, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x05, 0x02, 0x05, 0x18, 0x00, 0x00,
+        // 0x79, 6 columns
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x88, 0x90, 0x90, 0x48, 0x3F,
+        // 0x7A, 6 columns
+        0x40, 0x40, 0x40, 0x40, 0x40, 0xC0, 0x18, 0x14, 0x12, 0x12, 0x11, 0x10,
+        // 0x7B, 4 columns
+        0x00, 0x00, 0xFC, 0x02, 0x00, 0x01, 0x7E, 0x80,
+        // 0x7C, 2 columns
+        0x00, 0xFC, 0x00, 0x7F,
+        // 0x7D, 4 columns
+        0x00, 0x02, 0xFC, 0x00, 0x00, 0x80, 0x7E, 0x01,
+        // 0x7E, 7 columns
+        0x00, 0x10, 0x08, 0x08, 0x10, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        // 0x7F, 5 columns
+        0x00, 0x18, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const FontPages fontpages_f16 =
+{
+        16, 32, 96, FONT_PAGES_RAW,
+        widtbl_f16p, offtbl_f16p, pagtbl_f16p, 0
+};
@@ -0,0 +1,385 @@
+// Font32.c in page format, made by tools/fontconv.py.
+// Don't edit, change Font32.c and run the tool again.
+
+#include "FontPages.h"
+#include <avr/pgmspace.h>
+
+PROGMEM const unsigned char widtbl_f32p[96] =
+{
+        8, 11, 11, 22, 17, 24, 20, 9,
+        11, 11, 15, 13, 10, 11, 10, 11,
+        17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 10, 10, 17, 12, 17, 16,
+        28, 19, 20, 21, 21, 19, 18, 22,
+        21, 9, 16, 20, 16, 24, 21, 22,
+        19, 22, 20, 19, 17, 21, 18, 26,
+        18, 19, 19, 12, 16, 12, 15, 16,
+        12, 17, 18, 16, 18, 17, 11, 18,
+        18, 9, 9, 15, 9, 25, 18, 18,
+        18, 18, 11, 15, 10, 17, 15, 21,
+        16, 16, 15, 16, 16, 16, 18, 4
+};
+
+PROGMEM const unsigned short offtbl_f32p[96] =
+{
+        0, 4, 20, 32, 72, 116, 176, 228,
+        240, 264, 284, 312, 328, 340, 352, 364,
+        384, 428, 448, 496, 540, 572, 616, 664,
+        696, 740, 788, 808, 828, 852, 868, 892,
+        924, 1000, 1040, 1092, 1144, 1192, 1240, 1276,
+        1332, 1368, 1384, 1412, 1456, 1480, 1532, 1572,
+        1624, 1664, 1724, 1768, 1820, 1848, 1884, 1920,
+        1980, 2024, 2060, 2108, 2128, 2152, 2172, 2192,
+        2212, 2232, 2276, 2320, 2360, 2404, 2448, 2468,
+        2524, 2560, 2576, 2596, 1368, 2632, 2688, 2724,
+        2768, 2812, 2856, 2876, 2916, 2936, 2968, 3000,
+        3048, 3084, 3128, 3168, 3200, 3216, 3248, 3272
+};
+
+PROGMEM const unsigned char pagtbl_f32p[3276] FONT_PAGES_ALIGN =
+{
+        // 0x20, 8 columns
+        0x07, 0x07, 0x07, 0x07,
+        // 0x21, 11 columns
+        0x02, 0x81, 0xFE, 0xFE, 0x05, 0x02, 0x81, 0x3F, 0x3F, 0x05, 0x02, 0x81, 0x07, 0x07, 0x05, 0x0A,
+        // 0x22, 11 columns
+        0x01, 0x80, 0xFE, 0x01, 0x80, 0xFE, 0x04, 0x0A, 0x0A, 0x0A, 0x00, 0x00,
+        // 0x23, 22 columns
+        0x07, 0x82, 0xE0, 0x3C, 0x04, 0x00, 0x82, 0xE0, 0x3C, 0x04, 0x06, 0x01, 0x8E, 0x10, 0x11, 0x11,
+        0x91, 0xF1, 0x1F, 0x11, 0x91, 0xF1, 0x1F, 0x11, 0x11, 0x11, 0x11, 0x01, 0x04, 0x03, 0x81, 0x04,
+        0x07, 0x01, 0x81, 0x04, 0x07, 0x0B, 0x15, 0x00,
+        // 0x24, 17 columns
+        0x00, 0x8B, 0xE0, 0xF8, 0x18, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x18, 0x78, 0x60, 0x03, 0x00,
+        0x81, 0x05, 0x87, 0x40, 0x84, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x8B, 0x06, 0x07, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x03, 0x03, 0x10, 0x00,
+        // 0x25, 24 columns
+        0x00, 0x88, 0xE0, 0xF8, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0xF8, 0xE0, 0x01, 0x84, 0x80, 0xE0, 0x30,
+        0x1C, 0x04, 0x06, 0x01, 0x92, 0x03, 0x03, 0x06, 0x06, 0x06, 0x83, 0xE3, 0x30, 0x0C, 0x06, 0xE1,
+        0xF8, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0xF8, 0xE0, 0x02, 0x04, 0x82, 0x0C, 0x07, 0x01, 0x04, 0x86,
+        0x03, 0x03, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x17, 0x00, 0x00, 0x00,
+        // 0x26, 20 columns
+        0x02, 0x88, 0x78, 0xFC, 0x8E, 0x06, 0x06, 0x86, 0xCE, 0xFC, 0x78, 0x07, 0x00, 0x8D, 0xF0, 0xF8,
+        0x1C, 0x0E, 0x07, 0x07, 0x0F, 0x1D, 0x39, 0x70, 0xE0, 0xE0, 0x7C, 0x1C, 0x04, 0x00, 0x8F, 0x01,
+        0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01, 0x03, 0x07, 0x06, 0x04, 0x02,
+        0x13, 0x00, 0x00, 0x00,
+        // 0x27, 9 columns
+        0x00, 0x82, 0x4E, 0x6E, 0x3E, 0x04, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+        // 0x28, 11 columns
+        0x03, 0x83, 0xE0, 0xF8, 0x0E, 0x02, 0x02, 0x02, 0x41, 0x05, 0x02, 0x83, 0x03, 0x1F, 0x7C, 0xC0,
+        0x03, 0x05, 0x81, 0x01, 0x01, 0x02, 0x00, 0x00,
+        // 0x29, 11 columns
+        0x83, 0x02, 0x0E, 0xF8, 0xE0, 0x06, 0x02, 0x41, 0x05, 0x00, 0x83, 0xC0, 0x7C, 0x1F, 0x03, 0x05,
+        0x81, 0x01, 0x01, 0x08,
+        // 0x2A, 15 columns
+        0x00, 0x89, 0x20, 0x30, 0x60, 0xE0, 0xFE, 0xFE, 0xE0, 0x60, 0x30, 0x20, 0x03, 0x01, 0x82, 0x02,
+        0x07, 0x03, 0x01, 0x82, 0x03, 0x07, 0x02, 0x04, 0x0E, 0x0E, 0x00, 0x00,
+        // 0x2B, 13 columns
+        0x0C, 0x00, 0x82, 0x18, 0x18, 0x18, 0x41, 0x82, 0x18, 0x18, 0x18, 0x03, 0x0C, 0x0C, 0x00, 0x00,
+        // 0x2C, 10 columns
+        0x09, 0x09, 0x01, 0x82, 0x47, 0x77, 0x1F, 0x04, 0x09, 0x00, 0x00, 0x00,
+        // 0x2D, 11 columns
+        0x0A, 0x00, 0x85, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x03, 0x0A, 0x0A,
+        // 0x2E, 10 columns
+        0x09, 0x09, 0x01, 0x82, 0x07, 0x07, 0x07, 0x04, 0x09, 0x00, 0x00, 0x00,
+        // 0x2F, 11 columns
+        0x03, 0x83, 0x80, 0xF0, 0x3E, 0x06, 0x02, 0x01, 0x83, 0xE0, 0x7C, 0x0F, 0x01, 0x04, 0x82, 0x18,
+        0x1F, 0x03, 0x07, 0x0A,
+        // 0x30, 17 columns
+        0x00, 0x8B, 0xC0, 0xF0, 0x78, 0x18, 0x1C, 0x0C, 0x0C, 0x1C, 0x18, 0x78, 0xF0, 0xC0, 0x03, 0x00,
+        0x80, 0x7F, 0x40, 0x80, 0xC0, 0x05, 0x80, 0xC0, 0x40, 0x80, 0x7F, 0x03, 0x01, 0x89, 0x01, 0x03,
+        0x03, 0x07, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04, 0x10, 0x00, 0x00,
+        // 0x31, 17 columns
+        0x02, 0x85, 0x60, 0x60, 0x60, 0x70, 0xFC, 0xFC, 0x07, 0x06, 0x41, 0x07, 0x06, 0x81, 0x07, 0x07,
+        0x07, 0x10, 0x00, 0x00,
+        // 0x32, 17 columns
+        0x00, 0x8B, 0xE0, 0xF8, 0x38, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x18, 0xF8, 0xE0, 0x03, 0x00,
+        0x8B, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x38, 0x18, 0x1C, 0x0C, 0x0E, 0x07, 0x03, 0x03, 0x00, 0x8B,
+        0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x10, 0x00, 0x00,
+        // 0x33, 17 columns
+        0x00, 0x8A, 0x40, 0x70, 0x78, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0xF8, 0xF0, 0x04, 0x00, 0x82,
+        0xE0, 0xE0, 0x80, 0x01, 0x86, 0x06, 0x06, 0x06, 0x07, 0x8F, 0xFD, 0xF8, 0x03, 0x01, 0x89, 0x03,
+        0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x04, 0x10, 0x00,
+        // 0x34, 17 columns
+        0x04, 0x85, 0x80, 0xC0, 0x70, 0x38, 0xFC, 0xFC, 0x05, 0x00, 0x87, 0x70, 0x78, 0x6C, 0x67, 0x63,
+        0x60, 0x60, 0x60, 0x41, 0x81, 0x60, 0x60, 0x03, 0x08, 0x81, 0x07, 0x07, 0x05, 0x10, 0x00, 0x00,
+        // 0x35, 17 columns
+        0x01, 0x89, 0xFC, 0xFC, 0x0C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x0C, 0x0C, 0x04, 0x00, 0x89, 0xC6,
+        0xC7, 0x83, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x87, 0x40, 0x80, 0xFC, 0x03, 0x01, 0x89, 0x03,
+        0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x04, 0x10, 0x00,
+        // 0x36, 17 columns
+        0x00, 0x8B, 0x80, 0xF0, 0x78, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x78, 0x60, 0x03, 0x00,
+        0x80, 0x7F, 0x40, 0x89, 0x8E, 0x06, 0x03, 0x03, 0x03, 0x03, 0x07, 0x8E, 0xFE, 0xF8, 0x03, 0x01,
+        0x89, 0x01, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x04, 0x10, 0x00, 0x00, 0x00,
+        // 0x37, 17 columns
+        0x00, 0x8B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0xCC, 0xEC, 0x7C, 0x3C, 0x0C, 0x03, 0x04,
+        0x84, 0xF0, 0xFC, 0x1F, 0x03, 0x01, 0x06, 0x03, 0x81, 0x07, 0x07, 0x0A, 0x10, 0x00, 0x00, 0x00,
+        // 0x38, 17 columns
+        0x01, 0x89, 0xE0, 0xF8, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0xF8, 0xE0, 0x04, 0x00, 0x8B, 0xF0,
+        0xF8, 0x0D, 0x0F, 0x06, 0x06, 0x06, 0x06, 0x0F, 0x0D, 0xF8, 0xF0, 0x03, 0x01, 0x89, 0x03, 0x03,
+        0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x04, 0x10, 0x00, 0x00,
+        // 0x39, 17 columns
+        0x00, 0x8B, 0xE0, 0xF8, 0x38, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x38, 0xF0, 0xC0, 0x03, 0x00,
+        0x89, 0xC3, 0xCF, 0x0E, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x0C, 0xCE, 0x40, 0x80, 0x3F, 0x03, 0x01,
+        0x89, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x01, 0x04, 0x10, 0x00, 0x00, 0x00,
+        // 0x3A, 10 columns
+        0x01, 0x82, 0xC0, 0xC0, 0xC0, 0x04, 0x01, 0x82, 0x01, 0x01, 0x01, 0x04, 0x01, 0x82, 0x07, 0x07,
+        0x07, 0x04, 0x09, 0x00,
+        // 0x3B, 10 columns
+        0x01, 0x82, 0xC0, 0xC0, 0xC0, 0x04, 0x01, 0x82, 0x01, 0x01, 0x01, 0x04, 0x01, 0x82, 0x47, 0x77,
+        0x1F, 0x04, 0x09, 0x00,
+        // 0x3C, 17 columns
+        0x09, 0x82, 0x80, 0x80, 0x80, 0x03, 0x00, 0x8B, 0x08, 0x08, 0x14, 0x14, 0x16, 0x22, 0x22, 0x63,
+        0x41, 0xC1, 0x80, 0x80, 0x03, 0x10, 0x10, 0x00,
+        // 0x3D, 12 columns
+        0x0B, 0x00, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x03, 0x0B, 0x0B, 0x00, 0x00, 0x00,
+        // 0x3E, 17 columns
+        0x00, 0x82, 0x80, 0x80, 0x80, 0x0C, 0x00, 0x8B, 0x80, 0x80, 0xC1, 0x41, 0x63, 0x22, 0x22, 0x36,
+        0x14, 0x14, 0x08, 0x08, 0x03, 0x10, 0x10, 0x00,
+        // 0x3F, 16 columns
+        0x00, 0x8A, 0x70, 0x7C, 0x1C, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x8E, 0xFC, 0xF8, 0x03, 0x04, 0x85,
+        0x30, 0x3C, 0x3E, 0x07, 0x03, 0x01, 0x04, 0x04, 0x82, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x00, 0x00,
+        // 0x40, 28 columns
+        0x01, 0x95, 0x80, 0xE0, 0x30, 0x18, 0x08, 0x0C, 0x04, 0x86, 0x82, 0x42, 0x42, 0x42, 0xC2, 0x82,
+        0x82, 0xC6, 0x04, 0x0C, 0x18, 0x30, 0xE0, 0xC0, 0x03, 0x00, 0x80, 0x7E, 0x40, 0x80, 0x81, 0x02,
+        0x80, 0x7C, 0x40, 0x80, 0x83, 0x02, 0x81, 0x80, 0xF0, 0x40, 0x80, 0x0F, 0x01, 0x84, 0x80, 0xC0,
+        0x70, 0x3F, 0x0F, 0x03, 0x01, 0x92, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x10, 0x30, 0x21, 0x21, 0x21,
+        0x21, 0x20, 0x20, 0x31, 0x11, 0x11, 0x11, 0x09, 0x08, 0x06, 0x1B, 0x00,
+        // 0x41, 19 columns
+        0x03, 0x87, 0x80, 0xF0, 0x7E, 0x0E, 0x0E, 0x7E, 0xF0, 0x80, 0x06, 0x01, 0x8B, 0xE0, 0xFC, 0x3F,
+        0x33, 0x30, 0x30, 0x30, 0x30, 0x33, 0x3F, 0xFC, 0xE0, 0x04, 0x82, 0x04, 0x07, 0x07, 0x09, 0x82,
+        0x07, 0x07, 0x04, 0x02, 0x12, 0x00, 0x00, 0x00,
+        // 0x42, 20 columns
+        0x01, 0x8C, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0xFC, 0xFC, 0x04,
+        0x01, 0x41, 0x8B, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0F, 0x0D, 0xFD, 0xF0, 0x03,
+        0x01, 0x8C, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x04,
+        0x13, 0x00, 0x00, 0x00,
+        // 0x43, 21 columns
+        0x00, 0x8F, 0xC0, 0xF0, 0x78, 0x1C, 0x0C, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x1C,
+        0x78, 0x60, 0x03, 0x00, 0x80, 0x3F, 0x40, 0x81, 0xE0, 0x80, 0x08, 0x82, 0xC0, 0xF0, 0x70, 0x03,
+        0x02, 0x8C, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04,
+        0x14, 0x00, 0x00, 0x00,
+        // 0x44, 21 columns
+        0x01, 0x8E, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x1C, 0x78, 0xF0,
+        0xC0, 0x03, 0x01, 0x41, 0x08, 0x81, 0x80, 0xE0, 0x40, 0x80, 0x3F, 0x03, 0x01, 0x8C, 0x07, 0x07,
+        0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x05, 0x14, 0x00, 0x00, 0x00,
+        // 0x45, 19 columns
+        0x01, 0x8C, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03,
+        0x01, 0x41, 0x89, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x01, 0x8C,
+        0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x12, 0x00,
+        // 0x46, 18 columns
+        0x01, 0x8B, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x01,
+        0x41, 0x88, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x01, 0x81, 0x07, 0x07,
+        0x0D, 0x11, 0x00, 0x00,
+        // 0x47, 22 columns
+        0x00, 0x8F, 0xC0, 0xF0, 0x78, 0x1C, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x3C,
+        0x38, 0x20, 0x04, 0x00, 0x80, 0x3F, 0x40, 0x81, 0xE0, 0x80, 0x03, 0x87, 0x06, 0x06, 0x06, 0x06,
+        0x86, 0xC6, 0xFE, 0xFE, 0x04, 0x02, 0x8D, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06,
+        0x03, 0x03, 0x01, 0x03, 0x07, 0x04, 0x15, 0x00,
+        // 0x48, 21 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x09, 0x81, 0xFE, 0xFE, 0x04, 0x01, 0x41, 0x89, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x09, 0x81, 0x07, 0x07,
+        0x04, 0x14, 0x00, 0x00,
+        // 0x49, 9 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x04, 0x01, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x04, 0x08, 0x00, 0x00,
+        // 0x4A, 16 columns
+        0x08, 0x81, 0xFE, 0xFE, 0x04, 0x81, 0xE0, 0xE0, 0x06, 0x41, 0x04, 0x8A, 0x01, 0x03, 0x07, 0x06,
+        0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x01, 0x04, 0x0F, 0x00, 0x00, 0x00,
+        // 0x4B, 20 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x02, 0x88, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06, 0x02, 0x03,
+        0x01, 0x41, 0x89, 0x1C, 0x0E, 0x07, 0x07, 0x0F, 0x1C, 0x78, 0xF0, 0xC0, 0x80, 0x05, 0x01, 0x81,
+        0x07, 0x07, 0x07, 0x84, 0x01, 0x03, 0x07, 0x06, 0x04, 0x02, 0x13, 0x00,
+        // 0x4C, 16 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x0B, 0x01, 0x41, 0x0B, 0x01, 0x8A, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06,
+        0x06, 0x06, 0x06, 0x06, 0x06, 0x02, 0x0F, 0x00,
+        // 0x4D, 24 columns
+        0x01, 0x84, 0xFE, 0xFE, 0x1E, 0xFC, 0xE0, 0x06, 0x84, 0xE0, 0xFC, 0x1E, 0xFE, 0xFE, 0x04, 0x01,
+        0x41, 0x01, 0x83, 0x07, 0x3F, 0xF8, 0xC0, 0x00, 0x83, 0xC0, 0xF8, 0x3F, 0x07, 0x01, 0x41, 0x04,
+        0x01, 0x81, 0x07, 0x07, 0x03, 0x84, 0x01, 0x07, 0x07, 0x07, 0x01, 0x03, 0x81, 0x07, 0x07, 0x04,
+        0x17, 0x00, 0x00, 0x00,
+        // 0x4E, 21 columns
+        0x01, 0x86, 0xFE, 0xFE, 0x1E, 0x78, 0xF0, 0xC0, 0x80, 0x04, 0x81, 0xFE, 0xFE, 0x04, 0x01, 0x41,
+        0x02, 0x86, 0x03, 0x07, 0x1E, 0x3C, 0xF0, 0xE0, 0x80, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x07,
+        0x83, 0x01, 0x07, 0x07, 0x07, 0x04, 0x14, 0x00,
+        // 0x4F, 22 columns
+        0x00, 0x90, 0xC0, 0xF0, 0x78, 0x1C, 0x0C, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x1C,
+        0x78, 0xF0, 0xC0, 0x03, 0x00, 0x80, 0x3F, 0x40, 0x81, 0xE0, 0x80, 0x08, 0x81, 0x80, 0xE0, 0x40,
+        0x80, 0x3F, 0x03, 0x02, 0x8C, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03,
+        0x03, 0x01, 0x05, 0x15,
+        // 0x50, 19 columns
+        0x01, 0x8C, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0xFC, 0xF8, 0x03,
+        0x01, 0x41, 0x8A, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x01, 0x03, 0x01,
+        0x81, 0x07, 0x07, 0x0E, 0x12, 0x00, 0x00, 0x00,
+        // 0x51, 22 columns
+        0x00, 0x90, 0xC0, 0xF0, 0x78, 0x1C, 0x0C, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x0C, 0x1C,
+        0x78, 0xF0, 0xC0, 0x03, 0x00, 0x80, 0x3F, 0x40, 0x81, 0xE0, 0x80, 0x04, 0x85, 0x40, 0xE0, 0xC0,
+        0x80, 0x80, 0xE0, 0x40, 0x80, 0x3F, 0x03, 0x02, 0x8E, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06,
+        0x06, 0x06, 0x07, 0x03, 0x03, 0x07, 0x0E, 0x04, 0x03, 0x15, 0x00, 0x00,
+        // 0x52, 20 columns
+        0x01, 0x8D, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0xFC, 0xF8,
+        0x03, 0x01, 0x41, 0x8B, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x3F, 0xFB, 0xE0,
+        0x03, 0x01, 0x81, 0x07, 0x07, 0x09, 0x81, 0x07, 0x07, 0x03, 0x13, 0x00,
+        // 0x53, 19 columns
+        0x01, 0x8C, 0xF8, 0xFC, 0x8C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x7C, 0x78, 0x40, 0x03,
+        0x00, 0x8D, 0x20, 0xE0, 0xE1, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x0E, 0x0C, 0x1C, 0xF8, 0xF0,
+        0x03, 0x01, 0x8C, 0x01, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01,
+        0x03, 0x12, 0x00, 0x00,
+        // 0x54, 17 columns
+        0x8D, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02,
+        0x05, 0x41, 0x08, 0x05, 0x81, 0x07, 0x07, 0x08, 0x10, 0x00, 0x00, 0x00,
+        // 0x55, 21 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x09, 0x81, 0xFE, 0xFE, 0x04, 0x01, 0x41, 0x80, 0x80, 0x07, 0x80, 0x80,
+        0x41, 0x04, 0x02, 0x8B, 0x01, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x01,
+        0x05, 0x14, 0x00, 0x00,
+        // 0x56, 18 columns
+        0x83, 0x02, 0x1E, 0xFE, 0xE0, 0x06, 0x83, 0xE0, 0xFE, 0x1E, 0x02, 0x02, 0x02, 0x83, 0x07, 0x3F,
+        0xF8, 0xC0, 0x00, 0x83, 0xC0, 0xF8, 0x3F, 0x07, 0x05, 0x04, 0x84, 0x01, 0x07, 0x07, 0x07, 0x01,
+        0x07, 0x11, 0x00, 0x00,
+        // 0x57, 26 columns
+        0x83, 0x02, 0x1E, 0xFE, 0xF0, 0x04, 0x84, 0xF0, 0xFE, 0x0E, 0xFE, 0xF0, 0x04, 0x83, 0xF0, 0xFE,
+        0x1E, 0x02, 0x02, 0x01, 0x81, 0x01, 0x1F, 0x40, 0x80, 0xF0, 0x00, 0x80, 0xF0, 0x40, 0x80, 0x0F,
+        0x02, 0x80, 0x0F, 0x40, 0x80, 0xF0, 0x00, 0x80, 0xF0, 0x40, 0x81, 0x1F, 0x01, 0x04, 0x03, 0x83,
+        0x01, 0x07, 0x07, 0x07, 0x06, 0x83, 0x07, 0x07, 0x07, 0x01, 0x06, 0x19,
+        // 0x58, 18 columns
+        0x00, 0x85, 0x06, 0x0E, 0x3C, 0x70, 0xE0, 0x80, 0x00, 0x85, 0x80, 0xE0, 0x70, 0x3C, 0x0E, 0x06,
+        0x03, 0x01, 0x8A, 0x80, 0xC0, 0xF0, 0x39, 0x1F, 0x07, 0x1F, 0x39, 0xF0, 0xC0, 0x80, 0x04, 0x83,
+        0x04, 0x06, 0x07, 0x03, 0x06, 0x83, 0x03, 0x07, 0x06, 0x04, 0x02, 0x11,
+        // 0x59, 19 columns
+        0x86, 0x02, 0x06, 0x1E, 0x3C, 0xF0, 0xC0, 0x80, 0x01, 0x86, 0x80, 0xC0, 0xF0, 0x3C, 0x1E, 0x06,
+        0x02, 0x02, 0x04, 0x85, 0x01, 0x07, 0xFE, 0xFE, 0x07, 0x01, 0x07, 0x06, 0x81, 0x07, 0x07, 0x09,
+        0x12, 0x00, 0x00, 0x00,
+        // 0x5A, 19 columns
+        0x01, 0x8C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0xE6, 0x76, 0x3E, 0x1E, 0x0E, 0x03,
+        0x01, 0x88, 0x80, 0xC0, 0xE0, 0x70, 0x3C, 0x0E, 0x07, 0x03, 0x01, 0x07, 0x00, 0x8D, 0x07, 0x07,
+        0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x12, 0x00, 0x00,
+        // 0x5B, 12 columns
+        0x02, 0x84, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x03, 0x02, 0x41, 0x06, 0x02, 0x41, 0x82, 0xC0, 0xC0,
+        0xC0, 0x03, 0x0B, 0x00,
+        // 0x5C, 16 columns
+        0x01, 0x82, 0x07, 0x3C, 0xE0, 0x0A, 0x03, 0x83, 0x01, 0x0F, 0x78, 0xC0, 0x07, 0x06, 0x83, 0x03,
+        0x1E, 0xF0, 0x80, 0x04, 0x09, 0x80, 0x01, 0x04,
+        // 0x5D, 12 columns
+        0x00, 0x84, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x05, 0x03, 0x41, 0x05, 0x00, 0x82, 0xC0, 0xC0, 0xC0,
+        0x41, 0x05, 0x0B, 0x00,
+        // 0x5E, 15 columns
+        0x00, 0x8A, 0x20, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x06, 0x0C, 0x18, 0x30, 0x20, 0x02, 0x0E, 0x0E,
+        0x0E, 0x00, 0x00, 0x00,
+        // 0x5F, 16 columns
+        0x0F, 0x0F, 0x8C, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+        0x02, 0x0F, 0x00, 0x00,
+        // 0x60, 12 columns
+        0x00, 0x87, 0x78, 0xFC, 0xCE, 0x86, 0x86, 0xCE, 0xFC, 0x78, 0x02, 0x02, 0x83, 0x01, 0x01, 0x01,
+        0x01, 0x04, 0x0B, 0x0B,
+        // 0x61, 17 columns
+        0x01, 0x88, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x05, 0x00, 0x88, 0xE0, 0xF3,
+        0x33, 0x18, 0x18, 0x18, 0x18, 0x18, 0x19, 0x41, 0x04, 0x00, 0x8C, 0x01, 0x03, 0x07, 0x06, 0x06,
+        0x06, 0x06, 0x03, 0x01, 0x03, 0x07, 0x06, 0x06, 0x02, 0x10, 0x00, 0x00,
+        // 0x62, 18 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x00, 0x86, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x05, 0x01, 0x41,
+        0x82, 0x83, 0x01, 0x01, 0x01, 0x82, 0x01, 0x01, 0xC7, 0x40, 0x80, 0x7C, 0x03, 0x01, 0x8A, 0x07,
+        0x07, 0x01, 0x03, 0x07, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04, 0x11,
+        // 0x63, 16 columns
+        0x02, 0x87, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x04, 0x00, 0x80, 0x7C, 0x40, 0x82,
+        0xC7, 0x01, 0x01, 0x01, 0x83, 0x01, 0x01, 0xC3, 0xC2, 0x03, 0x01, 0x88, 0x01, 0x03, 0x03, 0x07,
+        0x06, 0x06, 0x07, 0x03, 0x03, 0x04, 0x0F, 0x00,
+        // 0x64, 18 columns
+        0x02, 0x86, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x81, 0xFE, 0xFE, 0x04, 0x00, 0x80,
+        0x7C, 0x40, 0x82, 0xC7, 0x01, 0x01, 0x01, 0x82, 0x01, 0x01, 0x83, 0x41, 0x04, 0x01, 0x8A, 0x01,
+        0x03, 0x03, 0x07, 0x06, 0x06, 0x07, 0x03, 0x01, 0x07, 0x07, 0x04, 0x11,
+        // 0x65, 17 columns
+        0x02, 0x87, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x05, 0x00, 0x80, 0x7C, 0x40, 0x89,
+        0xDF, 0x19, 0x19, 0x18, 0x18, 0x19, 0x19, 0x9B, 0x9F, 0x9C, 0x03, 0x01, 0x89, 0x01, 0x03, 0x03,
+        0x07, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04, 0x10, 0x00, 0x00, 0x00,
+        // 0x66, 11 columns
+        0x86, 0xC0, 0xC0, 0xFC, 0xFE, 0xC6, 0xC6, 0xC6, 0x03, 0x01, 0x41, 0x06, 0x01, 0x81, 0x07, 0x07,
+        0x06, 0x0A, 0x00, 0x00,
+        // 0x67, 18 columns
+        0x02, 0x86, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x81, 0xC0, 0xC0, 0x04, 0x00, 0x80,
+        0x7C, 0x40, 0x82, 0xC3, 0x01, 0x01, 0x01, 0x82, 0x01, 0x01, 0x83, 0x41, 0x04, 0x00, 0x89, 0x30,
+        0xF1, 0xC3, 0xC3, 0x87, 0x86, 0x86, 0x87, 0xC3, 0xE1, 0x40, 0x80, 0x3F, 0x04, 0x03, 0x85, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x00, 0x00,
+        // 0x68, 18 columns
+        0x01, 0x81, 0xFE, 0xFE, 0x00, 0x86, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x05, 0x01, 0x41,
+        0x81, 0x03, 0x01, 0x03, 0x80, 0x01, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x06, 0x81, 0x07, 0x07,
+        0x04, 0x11, 0x00, 0x00,
+        // 0x69, 9 columns
+        0x01, 0x81, 0xCE, 0xCE, 0x04, 0x01, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x04, 0x08, 0x00, 0x00,
+        // 0x6A, 9 columns
+        0x01, 0x81, 0xCE, 0xCE, 0x04, 0x01, 0x41, 0x04, 0x81, 0x80, 0x80, 0x41, 0x04, 0x82, 0x01, 0x01,
+        0x01, 0x05, 0x00, 0x00,
+        // 0x6B, 15 columns
+        0x01, 0x81, 0xFC, 0xFC, 0x03, 0x83, 0x80, 0xC0, 0xC0, 0x40, 0x02, 0x01, 0x41, 0x85, 0x38, 0x1C,
+        0x1E, 0x7F, 0xF3, 0xC1, 0x04, 0x01, 0x81, 0x07, 0x07, 0x03, 0x83, 0x01, 0x07, 0x07, 0x04, 0x02,
+        0x0E, 0x00, 0x00, 0x00,
+        // 0x6D, 25 columns
+        0x01, 0x81, 0xC0, 0xC0, 0x00, 0x85, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x86, 0x80, 0x80,
+        0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x05, 0x01, 0x41, 0x81, 0x03, 0x01, 0x02, 0x80, 0x01, 0x41, 0x81,
+        0x03, 0x01, 0x02, 0x80, 0x01, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x05, 0x81, 0x07, 0x07, 0x05,
+        0x81, 0x07, 0x07, 0x04, 0x18, 0x00, 0x00, 0x00,
+        // 0x6E, 18 columns
+        0x01, 0x81, 0xC0, 0xC0, 0x00, 0x86, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x05, 0x01, 0x41,
+        0x81, 0x03, 0x01, 0x03, 0x80, 0x01, 0x41, 0x04, 0x01, 0x81, 0x07, 0x07, 0x06, 0x81, 0x07, 0x07,
+        0x04, 0x11, 0x00, 0x00,
+        // 0x6F, 18 columns
+        0x02, 0x88, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x05, 0x00, 0x80, 0x7C, 0x40,
+        0x82, 0xC7, 0x01, 0x01, 0x02, 0x82, 0x01, 0x01, 0xC7, 0x40, 0x80, 0x7C, 0x03, 0x01, 0x8A, 0x01,
+        0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04, 0x11,
+        // 0x70, 18 columns
+        0x01, 0x81, 0xC0, 0xC0, 0x00, 0x86, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x05, 0x01, 0x41,
+        0x82, 0x83, 0x01, 0x01, 0x01, 0x82, 0x01, 0x01, 0xC7, 0x40, 0x80, 0x7C, 0x03, 0x01, 0x41, 0x88,
+        0x01, 0x03, 0x07, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x04, 0x11, 0x00,
+        // 0x71, 18 columns
+        0x02, 0x86, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x81, 0xC0, 0xC0, 0x04, 0x00, 0x80,
+        0x7C, 0x40, 0x82, 0xC7, 0x01, 0x01, 0x01, 0x82, 0x01, 0x01, 0x83, 0x41, 0x04, 0x01, 0x88, 0x01,
+        0x03, 0x03, 0x07, 0x06, 0x06, 0x07, 0x03, 0x01, 0x41, 0x04, 0x11, 0x00,
+        // 0x72, 11 columns
+        0x01, 0x85, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0x02, 0x01, 0x41, 0x80, 0x01, 0x05, 0x01, 0x81,
+        0x07, 0x07, 0x06, 0x0A,
+        // 0x73, 15 columns
+        0x01, 0x87, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x04, 0x00, 0x89, 0x87, 0x8F, 0x19,
+        0x18, 0x18, 0x38, 0x30, 0x31, 0xF3, 0xE2, 0x03, 0x00, 0x89, 0x01, 0x03, 0x07, 0x06, 0x06, 0x06,
+        0x06, 0x07, 0x03, 0x01, 0x03, 0x0E, 0x00, 0x00,
+        // 0x74, 10 columns
+        0x85, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0x03, 0x01, 0x41, 0x05, 0x01, 0x83, 0x03, 0x07, 0x06,
+        0x06, 0x03, 0x09, 0x00,
+        // 0x75, 17 columns
+        0x01, 0x81, 0xC0, 0xC0, 0x06, 0x81, 0xC0, 0xC0, 0x03, 0x01, 0x41, 0x05, 0x80, 0x80, 0x41, 0x03,
+        0x01, 0x8A, 0x01, 0x03, 0x07, 0x06, 0x06, 0x06, 0x06, 0x03, 0x01, 0x07, 0x07, 0x03, 0x10, 0x00,
+        // 0x76, 15 columns
+        0x81, 0xC0, 0xC0, 0x06, 0x81, 0xC0, 0xC0, 0x03, 0x00, 0x83, 0x07, 0x3F, 0xF8, 0xC0, 0x00, 0x83,
+        0xC0, 0xF8, 0x3F, 0x07, 0x04, 0x02, 0x84, 0x01, 0x07, 0x07, 0x07, 0x01, 0x06, 0x0E, 0x00, 0x00,
+        // 0x77, 21 columns
+        0x81, 0xC0, 0xC0, 0x04, 0x82, 0xC0, 0xC0, 0xC0, 0x04, 0x81, 0xC0, 0xC0, 0x03, 0x83, 0x01, 0x1F,
+        0xFE, 0xE0, 0x00, 0x82, 0xE0, 0xFE, 0x0F, 0x00, 0x82, 0x0F, 0xFE, 0xE0, 0x00, 0x83, 0xE0, 0xFE,
+        0x1F, 0x01, 0x03, 0x02, 0x82, 0x07, 0x07, 0x07, 0x04, 0x82, 0x07, 0x07, 0x07, 0x06, 0x14, 0x00,
+        // 0x78, 16 columns
+        0x00, 0x82, 0xC0, 0xC0, 0x80, 0x04, 0x82, 0x80, 0xC0, 0xC0, 0x03, 0x01, 0x88, 0x01, 0xC7, 0xEE,
+        0x7C, 0x38, 0x7C, 0xEE, 0xC7, 0x01, 0x04, 0x00, 0x82, 0x06, 0x07, 0x03, 0x04, 0x82, 0x03, 0x07,
+        0x06, 0x03, 0x0F, 0x00,
+        // 0x79, 16 columns
+        0x82, 0x40, 0xC0, 0xC0, 0x06, 0x82, 0xC0, 0xC0, 0x40, 0x02, 0x00, 0x84, 0x01, 0x0F, 0x7E, 0xF0,
+        0x80, 0x00, 0x84, 0x80, 0xF0, 0x7E, 0x0F, 0x01, 0x03, 0x00, 0x83, 0x80, 0x80, 0x80, 0xC3, 0x40,
+        0x82, 0x7C, 0x1F, 0x03, 0x06, 0x00, 0x83, 0x01, 0x01, 0x01, 0x01, 0x0A,
+        // 0x7A, 15 columns
+        0x00, 0x89, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x03, 0x01, 0x88, 0x80,
+        0xC0, 0xE0, 0x78, 0x3C, 0x0E, 0x07, 0x03, 0x01, 0x03, 0x00, 0x89, 0x07, 0x07, 0x07, 0x06, 0x06,
+        0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x0E, 0x00,
+        // 0x7B, 16 columns
+        0x05, 0x80, 0xFE, 0x40, 0x82, 0x03, 0x01, 0x01, 0x04, 0x02, 0x84, 0x10, 0x10, 0x38, 0xEF, 0xC7,
+        0x07, 0x05, 0x41, 0x80, 0x80, 0x06, 0x06, 0x83, 0x01, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x00,
+        // 0x7C, 16 columns
+        0x04, 0x41, 0x08, 0x04, 0x41, 0x08, 0x04, 0x41, 0x08, 0x04, 0x81, 0x01, 0x01, 0x08, 0x00, 0x00,
+        // 0x7D, 16 columns
+        0x01, 0x82, 0x01, 0x01, 0x03, 0x40, 0x80, 0xFE, 0x08, 0x04, 0x84, 0xC7, 0xEF, 0x38, 0x10, 0x10,
+        0x05, 0x03, 0x80, 0x80, 0x41, 0x08, 0x01, 0x83, 0x01, 0x01, 0x01, 0x01, 0x09, 0x00, 0x00, 0x00,
+        // 0x7E, 18 columns
+        0x00, 0x8E, 0x38, 0x0C, 0x06, 0x02, 0x02, 0x06, 0x0C, 0x08, 0x18, 0x30, 0x20, 0x20, 0x30, 0x18,
+        0x0E, 0x01, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00,
+        // 0x7F, 4 columns
+        0x03, 0x03, 0x03, 0x03
+};
+
+const FontPages fontpages_f32 =
+{
+        26, 32, 96, FONT_PAGES_RUNS,
+        widtbl_f32p, offtbl_f32p, pagtbl_f32p, 0
+};
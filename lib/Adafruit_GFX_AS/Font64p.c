@@ -0,0 +1,153 @@
+// Font64.c in page format, made by tools/fontconv.py.
+// Don't edit, change Font64.c and run the tool again.
+
+#include "FontPages.h"
+#include <avr/pgmspace.h>
+
+PROGMEM const unsigned char widtbl_f64p[96] =
+{
+        15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 20, 18, 15,
+        30, 30, 30, 30, 30, 30, 30, 30,
+        30, 30, 18, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 15, 15, 15,
+        15, 30, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 45, 15, 15,
+        32, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 10, 15, 15, 15
+};
+
+PROGMEM const unsigned short offtbl_f64p[96] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 8, 28, 0,
+        48, 136, 176, 272, 376, 460, 572, 692,
+        760, 876, 980, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1000, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1092, 0, 0,
+        1172, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1256, 0, 0, 0
+};
+
+PROGMEM const unsigned char pagtbl_f64p[1264] FONT_PAGES_ALIGN =
+{
+        // 0x20, 15 columns
+        0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
+        // 0x2D, 20 columns
+        0x13, 0x13, 0x02, 0x8A, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x05,
+        0x13, 0x13, 0x13, 0x00,
+        // 0x2E, 18 columns
+        0x11, 0x11, 0x11, 0x04, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x07, 0x04, 0x84, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x07, 0x11,
+        // 0x30, 30 columns
+        0x02, 0x93, 0xE0, 0xF0, 0xF8, 0xFC, 0x7C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E,
+        0x3C, 0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x06, 0x00, 0x80, 0xF0, 0x42, 0x81, 0x0F, 0x01, 0x0B, 0x81,
+        0x01, 0x0F, 0x42, 0x80, 0xF0, 0x04, 0x00, 0x43, 0x0F, 0x43, 0x04, 0x00, 0x81, 0x03, 0x3F, 0x41,
+        0x82, 0xFC, 0xE0, 0x80, 0x09, 0x82, 0x80, 0xE0, 0xFC, 0x41, 0x81, 0x3F, 0x03, 0x04, 0x02, 0x93,
+        0x01, 0x03, 0x07, 0x0F, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x0F, 0x0F,
+        0x0F, 0x07, 0x03, 0x01, 0x06, 0x1D, 0x00, 0x00,
+        // 0x31, 30 columns
+        0x09, 0x87, 0x80, 0x80, 0xC0, 0xE0, 0xF8, 0xFE, 0xFE, 0xFE, 0x0B, 0x04, 0x88, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x43, 0x0B, 0x0D, 0x43, 0x0B, 0x0D, 0x43, 0x0B, 0x0D, 0x83,
+        0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0x1D, 0x00, 0x00,
+        // 0x32, 30 columns
+        0x03, 0x93, 0xC0, 0xF0, 0xF8, 0xF8, 0xFC, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x3E,
+        0x3C, 0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x05, 0x02, 0x84, 0x1E, 0x1F, 0x1F, 0x1F, 0x03, 0x0B, 0x80,
+        0xC1, 0x43, 0x04, 0x07, 0x8F, 0x80, 0x80, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0x7C, 0x7E,
+        0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x05, 0x02, 0x8B, 0xE0, 0xF8, 0xFC, 0xFE, 0x3F, 0x1F, 0x0F, 0x07,
+        0x03, 0x03, 0x01, 0x01, 0x0E, 0x01, 0x96, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x1D,
+        // 0x33, 30 columns
+        0x01, 0x95, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0x7C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x3E, 0x3C, 0x7C, 0xFC, 0xF8, 0xF8, 0xE0, 0x80, 0x05, 0x01, 0x84, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,
+        0x09, 0x82, 0x80, 0xC0, 0xF1, 0x42, 0x80, 0x3F, 0x05, 0x09, 0x8E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0xFD, 0xFD, 0xF8, 0xF0, 0xC0, 0x04, 0x00, 0x81, 0x1F, 0x7F, 0x41,
+        0x84, 0xF8, 0xE0, 0xC0, 0x80, 0x80, 0x05, 0x84, 0x80, 0x80, 0xC0, 0xF0, 0xF8, 0x41, 0x81, 0x7F,
+        0x1F, 0x04, 0x03, 0x91, 0x01, 0x03, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x07, 0x07, 0x07, 0x03, 0x01, 0x07, 0x1D,
+        // 0x34, 30 columns
+        0x0B, 0x87, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x09, 0x05, 0x88, 0x80, 0xC0, 0xF0,
+        0xF8, 0x7C, 0x3F, 0x1F, 0x07, 0x03, 0x00, 0x43, 0x09, 0x00, 0x8E, 0xC0, 0xE0, 0xF8, 0xFC, 0xBF,
+        0x9F, 0x8F, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x43, 0x84, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x04, 0x00, 0x8E, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+        0x07, 0x07, 0x07, 0x43, 0x84, 0x07, 0x07, 0x07, 0x07, 0x07, 0x04, 0x0F, 0x83, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x09, 0x1D, 0x00,
+        // 0x35, 30 columns
+        0x03, 0x92, 0x80, 0xFC, 0xFC, 0xFC, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+        0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x06, 0x02, 0x80, 0xE0, 0x42, 0x8D, 0x83, 0xC0, 0xC0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x08, 0x02, 0x91, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x07, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3F, 0x40, 0x82,
+        0xFE, 0xFC, 0xE0, 0x04, 0x01, 0x85, 0x78, 0xF8, 0xF8, 0xF8, 0xC0, 0x80, 0x09, 0x82, 0x80, 0xC0,
+        0xF0, 0x42, 0x80, 0x1F, 0x04, 0x02, 0x93, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E,
+        0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x06, 0x1D, 0x00, 0x00, 0x00,
+        // 0x36, 30 columns
+        0x02, 0x94, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x3C, 0x3C, 0x7C, 0xF8, 0xF0, 0xE0, 0xC0, 0x05, 0x00, 0x81, 0xE0, 0xFE, 0x41, 0x81, 0x1F, 0x03,
+        0x00, 0x90, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80, 0x01, 0x07,
+        0x07, 0x07, 0x07, 0x04, 0x00, 0x43, 0x93, 0x7E, 0x1F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x07, 0x07, 0x0F, 0x1F, 0x7F, 0xFE, 0xFC, 0xF0, 0xC0, 0x04, 0x00, 0x81, 0x0F, 0x7F,
+        0x41, 0x82, 0xF0, 0xC0, 0x80, 0x09, 0x82, 0x80, 0xC0, 0xF0, 0x42, 0x80, 0x1F, 0x04, 0x02, 0x93,
+        0x01, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x0F,
+        0x0F, 0x07, 0x03, 0x01, 0x06, 0x1D, 0x00, 0x00,
+        // 0x37, 30 columns
+        0x01, 0x96, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+        0x3C, 0x3C, 0x3C, 0x3C, 0xBC, 0xFC, 0xFC, 0xFC, 0x7C, 0x04, 0x0C, 0x89, 0x80, 0xC0, 0xF0, 0xF8,
+        0xFC, 0x7E, 0x1F, 0x0F, 0x07, 0x01, 0x06, 0x09, 0x82, 0xE0, 0xF8, 0xFE, 0x40, 0x83, 0x7F, 0x0F,
+        0x03, 0x01, 0x0B, 0x07, 0x80, 0xF8, 0x42, 0x81, 0x0F, 0x01, 0x0F, 0x06, 0x84, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x01, 0x11, 0x1D,
+        // 0x38, 30 columns
+        0x01, 0x95, 0x80, 0xE0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3C, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x3C, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x05, 0x01, 0x81, 0x1F, 0x7F, 0x41, 0x83, 0xF1,
+        0xC0, 0x80, 0x80, 0x05, 0x83, 0x80, 0x80, 0xC0, 0xF1, 0x41, 0x81, 0x7F, 0x1F, 0x05, 0x00, 0x97,
+        0x80, 0xE0, 0xF0, 0xF8, 0xFD, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x1F, 0x1F, 0x3F, 0xFD, 0xF8, 0xF0, 0xE0, 0x80, 0x04, 0x00, 0x80, 0x7F, 0x42, 0x81, 0xE0, 0x80,
+        0x0B, 0x81, 0x80, 0xE0, 0x42, 0x80, 0x7F, 0x04, 0x01, 0x95, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x0F,
+        0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x01,
+        0x05, 0x1D, 0x00, 0x00,
+        // 0x39, 30 columns
+        0x01, 0x95, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0x7C, 0x3E, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x3E, 0x3C, 0x7C, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x05, 0x00, 0x80, 0xFE, 0x42, 0x80, 0x83, 0x0D,
+        0x80, 0x83, 0x42, 0x80, 0xFC, 0x04, 0x01, 0x92, 0x03, 0x0F, 0x1F, 0x3F, 0x7E, 0x7C, 0x78, 0xF8,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x78, 0x78, 0x3C, 0x3E, 0x1F, 0x43, 0x04, 0x00, 0x85, 0x38,
+        0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x09, 0x83, 0x80, 0xC0, 0xF0, 0xFE, 0x41, 0x81, 0x1F, 0x01, 0x04,
+        0x02, 0x92, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x0F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x0F,
+        0x0F, 0x07, 0x07, 0x03, 0x01, 0x07, 0x1D, 0x00,
+        // 0x3A, 18 columns
+        0x11, 0x04, 0x84, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x07, 0x11, 0x04, 0x84, 0xF8, 0xF8, 0xF8, 0xF8,
+        0xF8, 0x07, 0x11, 0x11,
+        // 0x61, 30 columns
+        0x1D, 0x02, 0x94, 0xC0, 0xE0, 0xF8, 0xF8, 0x7C, 0x3C, 0x3E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x3E, 0x3C, 0x7C, 0xFC, 0xF8, 0xF0, 0xC0, 0x05, 0x02, 0x90, 0x03, 0x83, 0xC3, 0xC3, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x78, 0x43, 0x05, 0x01, 0x80,
+        0xFC, 0x42, 0x85, 0x87, 0x03, 0x01, 0x01, 0x01, 0x01, 0x04, 0x82, 0x80, 0xC0, 0xE0, 0x43, 0x05,
+        0x02, 0x96, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x0E, 0x0F, 0x07,
+        0x07, 0x03, 0x01, 0x01, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x1D, 0x00,
+        // 0x6D, 45 columns
+        0x2C, 0x02, 0xA3, 0xFC, 0xFC, 0xFC, 0xFC, 0xE0, 0x78, 0x38, 0x3C, 0x1C, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x3E, 0x7E, 0xFC, 0xF8, 0xF0, 0xE0, 0xF0, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x3E, 0x7C, 0xFC, 0xF8, 0xF0, 0xC0, 0x05, 0x02, 0x43, 0x80, 0x01, 0x0A, 0x43, 0x80, 0x01,
+        0x0A, 0x43, 0x05, 0x02, 0x43, 0x0B, 0x43, 0x0B, 0x43, 0x05, 0x02, 0x83, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0B, 0x83, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0x83, 0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0x2C, 0x00, 0x00,
+        // 0x70, 32 columns
+        0x1F, 0x02, 0x96, 0xFC, 0xFC, 0xFC, 0xFC, 0xE0, 0xF0, 0x78, 0x3C, 0x3C, 0x1E, 0x1E, 0x1E, 0x1E,
+        0x1E, 0x1E, 0x3E, 0x3C, 0x7C, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x05, 0x02, 0x43, 0x80, 0x07, 0x0D,
+        0x80, 0x07, 0x42, 0x80, 0xFC, 0x04, 0x02, 0x43, 0x82, 0xF0, 0xC0, 0x80, 0x09, 0x82, 0x80, 0xE0,
+        0xF8, 0x41, 0x81, 0x7F, 0x0F, 0x04, 0x02, 0x43, 0x91, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1E,
+        0x1E, 0x1E, 0x1E, 0x1E, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x01, 0x06, 0x02, 0x83, 0x7F, 0x7F,
+        0x7F, 0x7F, 0x18, 0x00,
+        // 0x7C, 10 columns
+        0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00
+};
+
+const FontPages fontpages_f64 =
+{
+        48, 32, 96, FONT_PAGES_RUNS,
+        widtbl_f64p, offtbl_f64p, pagtbl_f64p, 0
+};
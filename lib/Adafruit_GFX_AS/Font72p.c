@@ -0,0 +1,202 @@
+// Font72.c in page format, made by tools/fontconv.py.
+// Don't edit, change Font72.c and run the tool again.
+
+#include "FontPages.h"
+#include <avr/pgmspace.h>
+
+PROGMEM const unsigned char widtbl_f72p[96] =
+{
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        53, 53, 53, 53, 53, 53, 53, 53,
+        53, 53, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27,
+        27, 27, 27, 27, 27, 27, 27, 27
+};
+
+PROGMEM const unsigned short offtbl_f72p[96] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 12, 0,
+        36, 232, 316, 540, 772, 920, 1176, 1440,
+        1620, 1880, 2136, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0
+};
+
+PROGMEM const unsigned char pagtbl_f72p[2172] FONT_PAGES_ALIGN =
+{
+        // 0x20, 27 columns
+        0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x00, 0x00,
+        // 0x2E, 27 columns
+        0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x48, 0x08, 0x08, 0x88, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x00,
+        // 0x30, 53 columns
+        0x0D, 0x98, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x0D, 0x07, 0x84, 0xC0, 0xE0,
+        0xF8, 0xFC, 0xFE, 0x44, 0x90, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x84, 0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x07, 0x04, 0x82,
+        0x80, 0xF8, 0xFE, 0x45, 0x82, 0x7F, 0x0F, 0x03, 0x12, 0x82, 0x03, 0x0F, 0x7F, 0x45, 0x82, 0xFE,
+        0xF0, 0x80, 0x04, 0x03, 0x80, 0xE0, 0x47, 0x80, 0x1F, 0x18, 0x80, 0x1F, 0x47, 0x80, 0xE0, 0x03,
+        0x03, 0x48, 0x1A, 0x48, 0x03, 0x03, 0x48, 0x1A, 0x48, 0x03, 0x03, 0x81, 0x01, 0x7F, 0x46, 0x81,
+        0xFE, 0x80, 0x16, 0x81, 0x80, 0xFE, 0x46, 0x81, 0x7F, 0x01, 0x03, 0x05, 0x81, 0x07, 0x1F, 0x46,
+        0x83, 0xFC, 0xF0, 0xC0, 0x80, 0x0E, 0x83, 0x80, 0xC0, 0xF0, 0xFC, 0x46, 0x81, 0x1F, 0x07, 0x05,
+        0x08, 0x86, 0x01, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x44, 0x8A, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC,
+        0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0x44, 0x86, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x08,
+        0x11, 0x90, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x01, 0x01, 0x01, 0x11,
+        // 0x31, 53 columns
+        0x1A, 0x87, 0x80, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x11, 0x12, 0x86, 0x80, 0xC0, 0xC0,
+        0xE0, 0xF0, 0xF8, 0xFC, 0x48, 0x11, 0x09, 0x87, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE,
+        0x42, 0x84, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x48, 0x11, 0x09, 0x88, 0x1F, 0x1F, 0x0F, 0x0F, 0x07,
+        0x07, 0x03, 0x03, 0x01, 0x06, 0x48, 0x11, 0x19, 0x48, 0x11, 0x19, 0x48, 0x11, 0x19, 0x48, 0x11,
+        0x19, 0x48, 0x11, 0x19, 0x48, 0x11, 0x19, 0x88, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x11, 0x00, 0x00,
+        // 0x32, 53 columns
+        0x0B, 0x9A, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x0D, 0x05, 0x84,
+        0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0x44, 0x92, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x85, 0xFE, 0xFC, 0xF8, 0xF0,
+        0xE0, 0x80, 0x06, 0x03, 0x83, 0x70, 0x7F, 0x7F, 0x7F, 0x44, 0x81, 0x0F, 0x03, 0x14, 0x81, 0x03,
+        0x0F, 0x47, 0x80, 0xFC, 0x05, 0x22, 0x82, 0x80, 0xE0, 0xF8, 0x46, 0x81, 0x7F, 0x0F, 0x05, 0x1B,
+        0x86, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x44, 0x84, 0x7F, 0x3F, 0x1F, 0x07, 0x01, 0x07,
+        0x12, 0x87, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0x44, 0x86, 0x7F, 0x3F, 0x3F, 0x1F,
+        0x0F, 0x07, 0x03, 0x0D, 0x09, 0x87, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFE, 0x44, 0x87,
+        0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x15, 0x04, 0x84, 0x80, 0xE0, 0xF8, 0xFC, 0xFE,
+        0x44, 0x86, 0x7F, 0x3F, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x1E, 0x02, 0x81, 0xF0, 0xFE, 0x6A, 0x04,
+        0x02, 0xAC, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04,
+        // 0x33, 53 columns
+        0x0C, 0x97, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x0F, 0x06, 0x84, 0xC0, 0xE0, 0xF8,
+        0xFC, 0xFE, 0x44, 0x90, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x84, 0xFE, 0xFC, 0xF8, 0xE0, 0x80, 0x08, 0x04, 0x8A, 0x30,
+        0x3E, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x03, 0x12, 0x80, 0x03, 0x47, 0x80, 0xFE,
+        0x07, 0x1B, 0x87, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0x44, 0x83, 0x7F, 0x1F, 0x0F,
+        0x01, 0x07, 0x14, 0x80, 0xF0, 0x40, 0x87, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x44,
+        0x87, 0xFB, 0xFB, 0xF1, 0xF1, 0xE0, 0xE0, 0xC0, 0x80, 0x08, 0x20, 0x85, 0x01, 0x01, 0x03, 0x07,
+        0x0F, 0x3F, 0x45, 0x83, 0xFE, 0xF8, 0xF0, 0x80, 0x03, 0x03, 0x88, 0x80, 0x80, 0x80, 0x80, 0xC0,
+        0xC0, 0xC0, 0xC0, 0xC0, 0x1A, 0x48, 0x03, 0x03, 0x82, 0x03, 0x1F, 0x7F, 0x46, 0x83, 0xF8, 0xE0,
+        0xC0, 0x80, 0x10, 0x83, 0x80, 0xC0, 0xF0, 0xF8, 0x46, 0x82, 0x3F, 0x0F, 0x01, 0x03, 0x06, 0x87,
+        0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x7F, 0x43, 0x8D, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC,
+        0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0x43, 0x87, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x0F,
+        0x07, 0x01, 0x07, 0x10, 0x91, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x11,
+        // 0x34, 53 columns
+        0x1F, 0x88, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0B, 0x19, 0x84, 0x80, 0xE0,
+        0xF0, 0xF8, 0xFC, 0x49, 0x0B, 0x13, 0x84, 0x80, 0xE0, 0xF0, 0xF8, 0xFE, 0x45, 0x80, 0x7F, 0x48,
+        0x0B, 0x0D, 0x84, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0x45, 0x84, 0x3F, 0x1F, 0x0F, 0x07, 0x01, 0x01,
+        0x48, 0x0B, 0x07, 0x84, 0xC0, 0xE0, 0xF0, 0xFC, 0xFE, 0x45, 0x84, 0x3F, 0x1F, 0x0F, 0x03, 0x01,
+        0x07, 0x48, 0x0B, 0x00, 0x85, 0x80, 0xC0, 0xE0, 0xF8, 0xFC, 0xFE, 0x44, 0x85, 0x7F, 0x3F, 0x1F,
+        0x0F, 0x03, 0x01, 0x0D, 0x48, 0x0B, 0x00, 0x6F, 0x03, 0x00, 0x9E, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x87, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x03, 0x1F, 0x48, 0x0B, 0x1F, 0x88, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x0B,
+        // 0x35, 53 columns
+        0x0A, 0xA1, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0x07, 0x09, 0x80, 0xF0, 0x47, 0x99, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x07, 0x07, 0x81, 0xC0, 0xFE, 0x46, 0x81, 0x7F, 0x03, 0x21, 0x06, 0x80,
+        0xF8, 0x47, 0x98, 0x9F, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+        0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x0B, 0x04, 0x80, 0xE0,
+        0x48, 0x95, 0x7F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+        0x07, 0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x7F, 0x44, 0x84, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x05,
+        0x08, 0x84, 0x01, 0x01, 0x01, 0x01, 0x01, 0x17, 0x81, 0x03, 0x1F, 0x47, 0x80, 0xF0, 0x03, 0x03,
+        0x88, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x19, 0x80, 0x80, 0x47, 0x80, 0x7F,
+        0x03, 0x03, 0x81, 0x03, 0x1F, 0x47, 0x83, 0xF8, 0xE0, 0xC0, 0x80, 0x0F, 0x84, 0x80, 0xC0, 0xE0,
+        0xF0, 0xFC, 0x45, 0x82, 0x7F, 0x1F, 0x07, 0x04, 0x06, 0x87, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x3F,
+        0x7F, 0x7F, 0x43, 0x8D, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE,
+        0xFE, 0xFE, 0x43, 0x86, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x08, 0x10, 0x90, 0x01, 0x01,
+        0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x12,
+        // 0x36, 53 columns
+        0x0E, 0x98, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0, 0x80, 0x0C, 0x07, 0x85, 0x80, 0xE0,
+        0xF0, 0xF8, 0xFC, 0xFE, 0x43, 0x91, 0x7F, 0x7F, 0x3F, 0x1F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x84, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x06,
+        0x04, 0x81, 0xE0, 0xF8, 0x46, 0x83, 0x3F, 0x0F, 0x03, 0x01, 0x12, 0x8A, 0x03, 0x1F, 0x7F, 0x7F,
+        0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x3F, 0x38, 0x04, 0x02, 0x81, 0x80, 0xFE, 0x46, 0x80, 0x1F, 0x03,
+        0x96, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x0C, 0x02, 0x48, 0x83, 0xF0, 0xF8, 0xFC, 0xFE,
+        0x40, 0x92, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F,
+        0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x85, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x05, 0x02, 0x48,
+        0x83, 0x3F, 0x07, 0x03, 0x01, 0x14, 0x82, 0x01, 0x07, 0x3F, 0x46, 0x81, 0xFE, 0xE0, 0x03, 0x02,
+        0x81, 0x03, 0x7F, 0x46, 0x80, 0xC0, 0x19, 0x80, 0x80, 0x48, 0x03, 0x04, 0x82, 0x07, 0x1F, 0x7F,
+        0x44, 0x84, 0xFE, 0xF8, 0xE0, 0xC0, 0x80, 0x10, 0x83, 0x80, 0xC0, 0xF0, 0xFC, 0x46, 0x81, 0x3F,
+        0x07, 0x04, 0x07, 0x87, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x43, 0x8C, 0xFE, 0xFE,
+        0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0x44, 0x86, 0x7F, 0x3F, 0x3F,
+        0x1F, 0x0F, 0x07, 0x01, 0x07, 0x12, 0x8F, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x11,
+        // 0x37, 53 columns
+        0x04, 0xAB, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x03, 0x04,
+        0xA2, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+        0x3F, 0x3F, 0x3F, 0xBF, 0x45, 0x82, 0x7F, 0x3F, 0x1F, 0x03, 0x20, 0x84, 0xC0, 0xE0, 0xF8, 0xFC,
+        0xFE, 0x42, 0x84, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x06, 0x1B, 0x83, 0xC0, 0xF0, 0xF8, 0xFE, 0x43,
+        0x83, 0x7F, 0x1F, 0x07, 0x03, 0x0C, 0x16, 0x83, 0x80, 0xE0, 0xF8, 0xFE, 0x44, 0x83, 0x7F, 0x1F,
+        0x07, 0x01, 0x10, 0x13, 0x82, 0x80, 0xF0, 0xFC, 0x45, 0x82, 0x7F, 0x0F, 0x03, 0x14, 0x11, 0x81,
+        0xE0, 0xFC, 0x46, 0x81, 0x1F, 0x03, 0x17, 0x0F, 0x81, 0xE0, 0xFE, 0x46, 0x81, 0x1F, 0x01, 0x19,
+        0x0E, 0x80, 0xF8, 0x47, 0x80, 0x0F, 0x1B, 0x0E, 0x88, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x1C, 0x00,
+        // 0x38, 53 columns
+        0x0C, 0x99, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x0D, 0x06, 0x84, 0xC0,
+        0xF0, 0xF8, 0xFC, 0xFE, 0x44, 0x91, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x44, 0x84, 0xFE, 0xFC, 0xF8, 0xE0, 0xC0, 0x07,
+        0x05, 0x80, 0xFE, 0x47, 0x80, 0x03, 0x13, 0x80, 0x03, 0x47, 0x80, 0xFE, 0x06, 0x05, 0x84, 0x01,
+        0x0F, 0x1F, 0x3F, 0x7F, 0x43, 0x95, 0xFE, 0xF8, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xE0, 0xF0, 0xF8, 0xFE, 0x43, 0x84, 0x7F, 0x7F,
+        0x1F, 0x0F, 0x01, 0x06, 0x08, 0x86, 0x80, 0xC0, 0xE0, 0xF1, 0xF1, 0xFB, 0xFB, 0x45, 0x87, 0x7F,
+        0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x45, 0x86, 0xFB, 0xF3, 0xF1, 0xE1, 0xE0, 0xC0, 0x80,
+        0x09, 0x04, 0x82, 0xF0, 0xFC, 0xFE, 0x45, 0x84, 0x3F, 0x0F, 0x07, 0x03, 0x01, 0x0C, 0x85, 0x01,
+        0x01, 0x03, 0x07, 0x0F, 0x3F, 0x45, 0x82, 0xFE, 0xF8, 0xE0, 0x05, 0x03, 0x48, 0x19, 0x48, 0x04,
+        0x03, 0x82, 0x03, 0x1F, 0x7F, 0x45, 0x84, 0xFE, 0xF8, 0xE0, 0xC0, 0x80, 0x0F, 0x84, 0x80, 0xC0,
+        0xE0, 0xF8, 0xFE, 0x45, 0x82, 0x7F, 0x1F, 0x03, 0x04, 0x06, 0x87, 0x01, 0x03, 0x07, 0x0F, 0x1F,
+        0x3F, 0x7F, 0x7F, 0x44, 0x8C, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE,
+        0xFE, 0xFE, 0x43, 0x87, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x07, 0x10, 0x91, 0x01,
+        0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01,
+        0x01, 0x11, 0x00, 0x00,
+        // 0x39, 53 columns
+        0x0D, 0x97, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x0E, 0x06, 0x84, 0xC0, 0xF0, 0xF8,
+        0xFC, 0xFE, 0x45, 0x91, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+        0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x42, 0x85, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0x80, 0x07, 0x03,
+        0x81, 0xC0, 0xFC, 0x46, 0x83, 0x7F, 0x0F, 0x03, 0x01, 0x13, 0x82, 0x03, 0x07, 0x3F, 0x45, 0x81,
+        0xF8, 0xC0, 0x04, 0x03, 0x48, 0x1A, 0x47, 0x80, 0xF0, 0x03, 0x03, 0x82, 0x01, 0x1F, 0x7F, 0x46,
+        0x83, 0xF8, 0xE0, 0xC0, 0x80, 0x10, 0x83, 0x80, 0xC0, 0xE0, 0xF8, 0x49, 0x03, 0x06, 0x86, 0x01,
+        0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0x45, 0x93, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+        0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x47, 0x80, 0x7F, 0x03,
+        0x08, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x8E, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x06, 0x81, 0xC0, 0xFE, 0x46, 0x80, 0x1F, 0x04,
+        0x04, 0x81, 0x07, 0x3F, 0x46, 0x83, 0xFE, 0xF0, 0xC0, 0x80, 0x0E, 0x84, 0x80, 0xC0, 0xE0, 0xF8,
+        0xFE, 0x45, 0x82, 0x3F, 0x0F, 0x01, 0x05, 0x06, 0x86, 0x01, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F,
+        0x44, 0x8B, 0xFE, 0xFE, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0x43, 0x87,
+        0x7F, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x09, 0x0F, 0x90, 0x01, 0x01, 0x01, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x13, 0x00, 0x00, 0x00,
+        // 0x3A, 27 columns
+        0x1A, 0x1A, 0x08, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x48,
+        0x08, 0x1A, 0x1A, 0x1A, 0x1A, 0x08, 0x48, 0x08, 0x08, 0x88, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x08
+};
+
+const FontPages fontpages_f72 =
+{
+        75, 32, 96, FONT_PAGES_RUNS,
+        widtbl_f72p, offtbl_f72p, pagtbl_f72p, 0
+};
@@ -0,0 +1,134 @@
+// Font7s.c in page format, made by tools/fontconv.py.
+// Don't edit, change Font7s.c and run the tool again.
+
+#include "FontPages.h"
+#include <avr/pgmspace.h>
+
+PROGMEM const unsigned char widtbl_f7sp[96] =
+{
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12
+};
+
+PROGMEM const unsigned short offtbl_f7sp[96] =
+{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 8, 0,
+        24, 128, 172, 288, 404, 496, 612, 736,
+        796, 928, 1052, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0
+};
+
+PROGMEM const unsigned char pagtbl_f7sp[1088] FONT_PAGES_ALIGN =
+{
+        // 0x20, 12 columns
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00,
+        // 0x2E, 12 columns
+        0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x02, 0x84, 0x38, 0x7C, 0x7C, 0x7C, 0x38, 0x03, 0x00, 0x00, 0x00,
+        // 0x30, 32 columns
+        0x01, 0x9A, 0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0x9C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x01, 0x45,
+        0x0E, 0x45, 0x02, 0x01, 0x85, 0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0E, 0x85, 0x0F, 0x1F, 0x1F,
+        0x3F, 0x3F, 0x7F, 0x02, 0x01, 0x40, 0x84, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0x0E, 0x85, 0xF8, 0xF8,
+        0xFC, 0xFC, 0xFE, 0xFE, 0x02, 0x01, 0x45, 0x0E, 0x45, 0x02, 0x01, 0x9A, 0x01, 0x03, 0x07, 0x07,
+        0x13, 0x39, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x39, 0x13, 0x07, 0x07, 0x03, 0x01, 0x02,
+        // 0x31, 32 columns
+        0x16, 0x85, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x16, 0x45, 0x02, 0x16, 0x85, 0x0F, 0x0F,
+        0x1F, 0x1F, 0x3F, 0x7F, 0x02, 0x16, 0x85, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x02, 0x16, 0x45,
+        0x02, 0x16, 0x85, 0x01, 0x03, 0x07, 0x07, 0x03, 0x01, 0x02, 0x00, 0x00,
+        // 0x32, 32 columns
+        0x05, 0x96, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x16, 0x45, 0x02, 0x03, 0x98, 0x80,
+        0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F, 0x02, 0x01, 0x40, 0x96, 0xFE, 0xFE, 0xFD, 0xFD,
+        0xFB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x01, 0x01, 0x05, 0x01, 0x45, 0x17, 0x01, 0x96, 0x01, 0x03, 0x07, 0x07, 0x13, 0x39, 0x7C,
+        0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x38, 0x10,
+        0x06, 0x00, 0x00, 0x00,
+        // 0x33, 32 columns
+        0x05, 0x96, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x16, 0x45, 0x02, 0x03, 0x98, 0x80,
+        0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F, 0x02, 0x04, 0x97, 0x01, 0x01, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFB, 0xF9, 0xFD,
+        0xFC, 0xFE, 0xFE, 0x02, 0x16, 0x45, 0x02, 0x05, 0x96, 0x10, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x39, 0x13, 0x07, 0x07, 0x03, 0x01,
+        0x02, 0x00, 0x00, 0x00,
+        // 0x34, 32 columns
+        0x01, 0x85, 0x80, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x0E, 0x85, 0x80, 0xC0, 0xE0, 0xF0, 0xE0, 0xC0,
+        0x02, 0x01, 0x45, 0x0E, 0x45, 0x02, 0x01, 0x9A, 0x7F, 0x3F, 0xBF, 0x9F, 0xDF, 0xCF, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xCF, 0xDF, 0x9F,
+        0xBF, 0x3F, 0x7F, 0x02, 0x04, 0x97, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFB, 0xF9, 0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0x16,
+        0x45, 0x02, 0x16, 0x85, 0x01, 0x03, 0x07, 0x07, 0x03, 0x01, 0x02, 0x00,
+        // 0x35, 32 columns
+        0x01, 0x96, 0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0x9C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x08, 0x06, 0x01, 0x45, 0x17, 0x01, 0x98, 0x7F,
+        0x3F, 0xBF, 0x9F, 0xDF, 0xCF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x04, 0x04, 0x97, 0x01, 0x01, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFB, 0xF9, 0xFD,
+        0xFC, 0xFE, 0xFE, 0x02, 0x16, 0x45, 0x02, 0x05, 0x96, 0x10, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x39, 0x13, 0x07, 0x07, 0x03, 0x01,
+        0x02, 0x00, 0x00, 0x00,
+        // 0x36, 32 columns
+        0x01, 0x96, 0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0x9C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x08, 0x06, 0x01, 0x45, 0x17, 0x01, 0x98, 0x7F,
+        0x3F, 0xBF, 0x9F, 0xDF, 0xCF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x04, 0x01, 0x40, 0x99, 0xFE, 0xFE, 0xFD, 0xFD,
+        0xFB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0xFB, 0xF9, 0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0x01, 0x45, 0x0E, 0x45, 0x02, 0x01, 0x9A, 0x01, 0x03,
+        0x07, 0x07, 0x13, 0x39, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x7C, 0x7C, 0x39, 0x13, 0x07, 0x07, 0x03, 0x01, 0x02, 0x00, 0x00,
+        // 0x37, 32 columns
+        0x05, 0x96, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x16, 0x45, 0x02, 0x16, 0x85, 0x0F,
+        0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x02, 0x16, 0x85, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0x02, 0x16,
+        0x45, 0x02, 0x16, 0x85, 0x01, 0x03, 0x07, 0x07, 0x03, 0x01, 0x02, 0x00,
+        // 0x38, 32 columns
+        0x01, 0x9A, 0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0x9C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x01, 0x45,
+        0x0E, 0x45, 0x02, 0x01, 0x9A, 0x7F, 0x3F, 0xBF, 0x9F, 0xDF, 0xCF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F,
+        0x02, 0x01, 0x40, 0x99, 0xFE, 0xFE, 0xFD, 0xFD, 0xFB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFB, 0xF9, 0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0x01,
+        0x45, 0x0E, 0x45, 0x02, 0x01, 0x9A, 0x01, 0x03, 0x07, 0x07, 0x13, 0x39, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x39, 0x13, 0x07, 0x07, 0x03,
+        0x01, 0x02, 0x00, 0x00,
+        // 0x39, 32 columns
+        0x01, 0x9A, 0x80, 0xC0, 0xE0, 0xE0, 0xC8, 0x9C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+        0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x9C, 0xC8, 0xE0, 0xF0, 0xE0, 0xC0, 0x02, 0x01, 0x45,
+        0x0E, 0x45, 0x02, 0x01, 0x9A, 0x7F, 0x3F, 0xBF, 0x9F, 0xDF, 0xCF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+        0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xCF, 0xDF, 0x9F, 0xBF, 0x3F, 0x7F,
+        0x02, 0x04, 0x97, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x03, 0x03, 0x03, 0x03, 0xFB, 0xF9, 0xFD, 0xFC, 0xFE, 0xFE, 0x02, 0x16, 0x45, 0x02, 0x05,
+        0x96, 0x10, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+        0x7C, 0x7C, 0x39, 0x13, 0x07, 0x07, 0x03, 0x01, 0x02, 0x00, 0x00, 0x00,
+        // 0x3A, 12 columns
+        0x0B, 0x02, 0x84, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x03, 0x02, 0x84, 0x01, 0x03, 0x03, 0x03, 0x01,
+        0x03, 0x02, 0x84, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x03, 0x02, 0x84, 0x03, 0x07, 0x07, 0x07, 0x03,
+        0x03, 0x0B, 0x00, 0x00
+};
+
+const FontPages fontpages_f7s =
+{
+        48, 32, 96, FONT_PAGES_RUNS,
+        widtbl_f7sp, offtbl_f7sp, pagtbl_f7sp, 0
+};
@@ -0,0 +1,43 @@
+#ifndef _FONT_PAGES_H
+#define _FONT_PAGES_H
+
+// The fonts in page format, for displays that store 8 rows per byte like the
+// SSD1306.  tools/fontconv.py makes FontNNp.c from FontNN.c.
+//
+// A glyph is widths[c] columns wide and height rows high, kept as pages of
+// 8 rows: the byte of each column for rows 0-7 (bit 0 at the top), then the
+// bytes for rows 8-15 and so on, so (height+7)/8 runs of widths[c] bytes.
+// It starts offsets[c] bytes into bitmap, on a 4 byte boundary so that it
+// can be read a 32 bit word at a time.  The tables are in PROGMEM.
+//
+// FONT_PAGES_RUNS fonts code each page of a glyph as runs, a byte n gives
+//   0x00-0x3F  n+1 bytes 0x00
+//   0x40-0x7F  n-0x40+1 bytes 0xFF
+//   0x80-0xFF  n-0x80+1 bytes, copied from the bytes after it
+// and no run goes on into the next page.
+//
+// A font cut down to some characters (FONTn_CHARS in Load_fonts.h) has a
+// map: the table entry of each character from first on, 0xFF for the ones
+// it doesn't have.  Without one character first+c is table entry c.
+
+#define FONT_PAGES_RAW  0 // The page bytes as they are
+#define FONT_PAGES_RUNS 1 // Run length coded
+
+#define FONT_PAGES_ALIGN __attribute__((aligned(4))) // Of the bitmap table
+
+typedef struct {
+  unsigned char
+    height,   // Rows of every glyph
+    first,    // Character of the first table entry
+    count,    // Characters from first on
+    encoding; // FONT_PAGES_RAW or FONT_PAGES_RUNS
+  const unsigned char  *widths;
+  const unsigned short *offsets;
+  const unsigned char  *bitmap;
+  const unsigned char  *map; // Null when all characters are there
+} FontPages;
+
+extern const FontPages
+  fontpages_f16, fontpages_f32, fontpages_f64, fontpages_f72, fontpages_f7s;
+
+#endif // _FONT_PAGES_H
@@ -6,4 +6,19 @@
 //#define LOAD_FONT4 // Medium font, needs ~8126 bytes in FLASH
 //#define LOAD_FONT6 // Large font, needs ~4404 bytes in FLASH
 //#define LOAD_FONT7 // 7 segment font, needs ~3652 bytes in FLASH
-//#define LOAD_FONT8 // Large font needs ~10kbytes, only 1234567890:.
\ No newline at end of file
+//#define LOAD_FONT8 // Large font needs ~10kbytes, only 1234567890:.
+
+// Keep fonts 2 to 8 in page format (FontNNp.c, made by tools/fontconv.py)
+// instead of the row format tables.  The large fonts are run length coded
+// there in about half the flash, all five need about 10.5 kbytes:
+// font 2 ~1532, font 4 ~3564, font 6 ~1552, font 7 ~1376, font 8 ~2460.
+#define LOAD_FONT_PAGES
+
+// A page format font can keep just the characters the sketch prints with
+// it, e.g. a clock in font 7.  Set them here and run tools/fontconv.py again,
+// the others are not drawn then.
+//#define FONT2_CHARS " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+//#define FONT4_CHARS "0123456789:.- "
+//#define FONT6_CHARS "0123456789:.- "
+//#define FONT7_CHARS "0123456789:. "
+//#define FONT8_CHARS "0123456789:. "
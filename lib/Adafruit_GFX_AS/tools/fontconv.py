@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Font build step for the Adafruit_GFX_AS fonts.
+
+Reads the row format fonts (Font16.c, Font32.c, ...: one bit per pixel, rows
+of whole bytes, MSB left) and writes each one again in page format next to
+it as Font16p.c, Font32p.c, ...  See FontPages.h for the layout.  The
+glyphs are stored as they are or run length coded, whichever is smaller,
+each one starting on a 4 byte boundary for the 32 bit flash reads of the
+ESP8266.
+
+A font can be cut down to the characters the firmware prints with it, set
+in Load_fonts.h as e.g.
+
+    #define FONT7_CHARS "0123456789: "
+
+for font 7 (Font7s.c).  Only those glyphs are written then, with a table
+that maps the characters to them.
+
+    python3 tools/fontconv.py                 # all fonts of the library
+    python3 tools/fontconv.py Font7s.c        # just this one
+    python3 tools/fontconv.py --encoding runs # run length code all of them
+    python3 tools/fontconv.py --chars "0123456789:" Font72.c
+
+Run it again after changing a row format font or a FONTn_CHARS, the page
+format files are not meant to be edited.  make -C test/host checks that the
+checked in ones are what this writes.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+LIBDIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+# the font numbers of drawString() and their row format files
+FONTS = {2: "Font16.c", 4: "Font32.c", 6: "Font64.c", 7: "Font7s.c", 8: "Font72.c"}
+
+
+def numbers(text):
+    return [int(n, 0) for n in re.findall(r"\b(?:0x[0-9A-Fa-f]+|\d+)\b", text)]
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def declared_chars(path):
+    """The FONTn_CHARS strings of Load_fonts.h, by font number."""
+    with open(path) as f:
+        text = strip_comments(f.read())
+    return dict(
+        (int(n), chars.encode("latin-1").decode("unicode_escape"))
+        for n, chars in re.findall(
+            r'#define\s+FONT(\d+)_CHARS\s+"((?:[^"\\]|\\.)*)"', text))
+
+
+class Font:
+    """A row format font: its height, width table and glyph rows."""
+
+    def __init__(self, path):
+        self.path = path
+        base = os.path.splitext(path)[0]
+        with open(base + ".h") as f:
+            header = f.read()
+        with open(path) as f:
+            source = strip_comments(f.read())
+
+        m = re.search(r"#define\s+chr_hgt_(\w+)\s+(\d+)", header)
+        if not m:
+            sys.exit("%s: no chr_hgt_ define" % (base + ".h"))
+        self.suffix, self.height = m.group(1), int(m.group(2))
+        m = re.search(r"#define\s+firstchr_%s\s+(\d+)" % self.suffix, header)
+        self.first = int(m.group(1)) if m else 32
+
+        tables = dict(
+            (name, body) for name, body in re.findall(
+                r"(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\}", source, flags=re.S))
+        self.widths = numbers(tables["widtbl_" + self.suffix])
+        names = re.findall(r"\w+", tables["chrtbl_" + self.suffix])
+        self.glyphs = []
+        for c, name in enumerate(names):
+            data = numbers(tables[name])
+            if len(data) % self.height:
+                sys.exit("%s: %s isn't %d rows" % (path, name, self.height))
+            self.glyphs.append((name, data, len(data) // self.height))
+        if len(self.widths) != len(self.glyphs):
+            sys.exit("%s: %d widths for %d glyphs" %
+                     (path, len(self.widths), len(self.glyphs)))
+
+    def pixel(self, c, x, y):
+        name, data, stride = self.glyphs[c]
+        if x >= stride * 8:
+            return 0
+        return (data[y * stride + x // 8] >> (7 - x % 8)) & 1
+
+    def pages(self, c):
+        """Glyph c as page bytes: the columns of rows 0-7, then 8-15..."""
+        out = []
+        for page in range((self.height + 7) // 8):
+            for x in range(self.widths[c]):
+                byte = 0
+                for bit in range(8):
+                    y = page * 8 + bit
+                    if y < self.height and self.pixel(c, x, y):
+                        byte |= 1 << bit
+                out.append(byte)
+        return out
+
+
+def encode_runs(data, width):
+    """Run length code page bytes, a page (width bytes) at a time: runs of
+    0x00 and 0xFF bytes and runs of other bytes that are copied."""
+    out = []
+    for start in range(0, len(data), width):
+        page = data[start:start + width]
+        i = 0
+        while i < len(page):
+            n = 1
+            if page[i] in (0x00, 0xFF):
+                while i + n < len(page) and page[i + n] == page[i] and n < 64:
+                    n += 1
+                out.append((0x40 if page[i] else 0x00) | (n - 1))
+            else:
+                while (i + n < len(page) and page[i + n] not in (0x00, 0xFF)
+                       and n < 128):
+                    n += 1
+                out.append(0x80 | (n - 1))
+                out.extend(page[i:i + n])
+            i += n
+    return out
+
+
+def c_bytes(data, indent="        ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def layout(font, runs, entries):
+    """The bitmap table, the offset of each of the glyphs entries in it and
+    the glyphs that start a block of it.  Glyphs that come out the same (the
+    spaces of the number fonts) are stored once, blocks are padded to whole
+    32 bit words."""
+    bitmap, offsets, seen, blocks = [], [], {}, []
+    for c in entries:
+        data = font.pages(c)
+        if runs:
+            data = encode_runs(data, font.widths[c])
+        data = tuple(data) + (0,) * (-len(data) % 4)
+        if data not in seen:
+            seen[data] = len(bitmap)
+            blocks.append((c, len(bitmap), data))
+            bitmap.extend(data)
+        offsets.append(seen[data])
+    return bitmap, offsets, blocks
+
+
+def c_numbers(data, per_line=8):
+    return ",\n".join("        " + ", ".join("%d" % n for n in data[i:i + per_line])
+                      for i in range(0, len(data), per_line))
+
+
+def convert(path, encoding, chars=None):
+    font = Font(path)
+    sfx = font.suffix
+
+    # the glyphs to write, all of them or the ones of chars with a map from
+    # the characters first..first+count-1 to them
+    if chars is None:
+        first, entries, charmap = font.first, list(range(len(font.glyphs))), None
+    else:
+        codes = sorted(set(ord(ch) for ch in chars))
+        for code in codes:
+            if not font.first <= code < font.first + len(font.glyphs):
+                sys.exit("%s: no glyph for %r" % (path, chr(code)))
+        if not codes:
+            sys.exit("%s: no characters to write" % path)
+        first = codes[0]
+        entries = [code - font.first for code in codes]
+        charmap = [0xFF] * (codes[-1] - first + 1)
+        for i, code in enumerate(codes):
+            charmap[code - first] = i
+    count = len(entries) if charmap is None else len(charmap)
+
+    raw = layout(font, False, entries)
+    coded = layout(font, True, entries)
+    if encoding == "runs" or (encoding == "auto" and len(coded[0]) < len(raw[0])):
+        encoding, (bitmap, offsets, blocks) = "runs", coded
+    else:
+        encoding, (bitmap, offsets, blocks) = "raw", raw
+    if len(bitmap) > 0xFFFF:
+        sys.exit("%s: %d bytes don't fit 16 bit offsets" % (path, len(bitmap)))
+
+    # columns the width table cuts off
+    for c in entries:
+        name, data, stride = font.glyphs[c]
+        for y in range(font.height):
+            for x in range(font.widths[c], stride * 8):
+                if font.pixel(c, x, y):
+                    print("%s: %s has pixels past its width, dropped" %
+                          (path, name), file=sys.stderr)
+                    break
+            else:
+                continue
+            break
+
+    src = os.path.basename(path)
+    out = os.path.splitext(path)[0] + "p.c"
+    with open(out, "w") as f:
+        f.write("// %s in page format, made by tools/fontconv.py.\n" % src)
+        f.write("// Don't edit, change %s and run the tool again.\n" % src)
+        if charmap is not None:
+            f.write("// Only the characters \"%s\".\n" %
+                    "".join(chr(font.first + c) for c in entries))
+        f.write('\n#include "FontPages.h"\n#include <avr/pgmspace.h>\n\n')
+        if charmap is not None:
+            f.write("PROGMEM const unsigned char maptbl_%sp[%d] =\n{\n" % (sfx, len(charmap)))
+            f.write(c_numbers(charmap).replace("255", "0xFF"))
+            f.write("\n};\n\n")
+        f.write("PROGMEM const unsigned char widtbl_%sp[%d] =\n{\n" % (sfx, len(entries)))
+        f.write(c_numbers([font.widths[c] for c in entries]))
+        f.write("\n};\n\n")
+        f.write("PROGMEM const unsigned short offtbl_%sp[%d] =\n{\n" % (sfx, len(entries)))
+        f.write(c_numbers(offsets))
+        f.write("\n};\n\n")
+        f.write("PROGMEM const unsigned char pagtbl_%sp[%d] FONT_PAGES_ALIGN =\n{\n" %
+                (sfx, len(bitmap)))
+        parts = []
+        for c, offset, data in blocks:
+            parts.append("        // 0x%02X, %d columns\n%s" %
+                         (font.first + c, font.widths[c], c_bytes(data)))
+        f.write(",\n".join(p for p in parts if not p.endswith("columns\n")))
+        f.write("\n};\n\n")
+        f.write("const FontPages fontpages_%s =\n{\n" % sfx)
+        f.write("        %d, %d, %d, %s,\n" % (font.height, first, count,
+                "FONT_PAGES_RUNS" if encoding == "runs" else "FONT_PAGES_RAW"))
+        f.write("        widtbl_%sp, offtbl_%sp, pagtbl_%sp, %s\n};\n" %
+                (sfx, sfx, sfx, "0" if charmap is None else "maptbl_%sp" % sfx))
+    size = len(bitmap) + 3 * len(entries) + (len(charmap) if charmap else 0)
+    print("%s: %d glyphs, %d bitmap bytes %s (%d raw), %d bytes of tables" %
+          (out, len(entries), len(bitmap), encoding, len(raw[0]), size))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Write Adafruit_GFX_AS fonts in page format.")
+    parser.add_argument("fonts", nargs="*",
+                        help="row format fonts (default: all of the library)")
+    parser.add_argument("--encoding", choices=["auto", "raw", "runs"],
+                        default="auto",
+                        help="glyph storage (default: the smaller one)")
+    parser.add_argument("--chars",
+                        help="write only these characters of the fonts "
+                        "(default: FONTn_CHARS of Load_fonts.h, or all)")
+    args = parser.parse_args()
+    declared = declared_chars(os.path.join(LIBDIR, "Load_fonts.h"))
+    numbers = dict((name, n) for n, name in FONTS.items())
+    paths = args.fonts or [os.path.join(LIBDIR, FONTS[n]) for n in sorted(FONTS)]
+    for path in paths:
+        chars = args.chars
+        if chars is None:
+            chars = declared.get(numbers.get(os.path.basename(path)))
+        convert(path, args.encoding, chars)
+
+
+if __name__ == "__main__":
+    main()
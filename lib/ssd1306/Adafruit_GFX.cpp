@@ -32,6 +32,7 @@ POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "Adafruit_GFX.h"
+#include "Adafruit_GFX_Raster.h"
 #include "glcdfont.c"
 #ifdef __AVR__
  #include <avr/pgmspace.h>
@@ -49,166 +50,47 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h):
   textsize  = 1;
   textcolor = textbgcolor = 0xFFFF;
   wrap      = true;
+  resetClip();
 }
 
+// The algorithms live in Adafruit_GFX_Raster, here they draw through the
+// virtual drawPixel() and span functions.
+typedef Adafruit_GFX_Raster<Adafruit_GFX> Raster;
+
 // Draw a circle outline
 void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
     uint16_t color) {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
-
-  drawPixel(x0  , y0+r, color);
-  drawPixel(x0  , y0-r, color);
-  drawPixel(x0+r, y0  , color);
-  drawPixel(x0-r, y0  , color);
-
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-  
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
-  }
+  Raster::drawCircle(*this, x0, y0, r, color);
 }
 
 void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
                int16_t r, uint8_t cornername, uint16_t color) {
-  int16_t f     = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x     = 0;
-  int16_t y     = r;
-
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f     += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f     += ddF_x;
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    } 
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
-    }
-  }
+  Raster::drawCircleHelper(*this, x0, y0, r, cornername, color);
 }
 
 void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r,
 			      uint16_t color) {
-  drawFastVLine(x0, y0-r, 2*r+1, color);
-  fillCircleHelper(x0, y0, r, 3, 0, color);
+  Raster::fillCircle(*this, x0, y0, r, color);
 }
 
 // Used to do circles and roundrects
 void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     uint8_t cornername, int16_t delta, uint16_t color) {
-
-  int16_t f     = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x     = 0;
-  int16_t y     = r;
-
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f     += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f     += ddF_x;
-
-    if (cornername & 0x1) {
-      drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
-    }
-    if (cornername & 0x2) {
-      drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
-    }
-  }
+  Raster::fillCircleHelper(*this, x0, y0, r, cornername, delta, color);
 }
 
 // Bresenham's algorithm - thx wikpedia
 void Adafruit_GFX::drawLine(int16_t x0, int16_t y0,
 			    int16_t x1, int16_t y1,
 			    uint16_t color) {
-  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
-  if (steep) {
-    swap(x0, y0);
-    swap(x1, y1);
-  }
-
-  if (x0 > x1) {
-    swap(x0, x1);
-    swap(y0, y1);
-  }
-
-  int16_t dx, dy;
-  dx = x1 - x0;
-  dy = abs(y1 - y0);
-
-  int16_t err = dx / 2;
-  int16_t ystep;
-
-  if (y0 < y1) {
-    ystep = 1;
-  } else {
-    ystep = -1;
-  }
-
-  for (; x0<=x1; x0++) {
-    if (steep) {
-      drawPixel(y0, x0, color);
-    } else {
-      drawPixel(x0, y0, color);
-    }
-    err -= dy;
-    if (err < 0) {
-      y0 += ystep;
-      err += dx;
-    }
-  }
+  Raster::drawLine(*this, x0, y0, x1, y1, color);
 }
 
 // Draw a rectangle
 void Adafruit_GFX::drawRect(int16_t x, int16_t y,
 			    int16_t w, int16_t h,
 			    uint16_t color) {
-  drawFastHLine(x, y, w, color);
-  drawFastHLine(x, y+h-1, w, color);
-  drawFastVLine(x, y, h, color);
-  drawFastVLine(x+w-1, y, h, color);
+  Raster::drawRect(*this, x, y, w, h, color);
 }
 
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
@@ -223,6 +105,12 @@ void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
   drawLine(x, y, x+w-1, y, color);
 }
 
+void Adafruit_GFX::drawSpan(int16_t y, int16_t x0, int16_t x1,
+			    uint16_t color) {
+  // Update in subclasses if desired!
+  drawFastHLine(x0, y, x1-x0+1, color);
+}
+
 void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 			    uint16_t color) {
   // Update in subclasses if desired!
@@ -238,129 +126,33 @@ void Adafruit_GFX::fillScreen(uint16_t color) {
 // Draw a rounded rectangle
 void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w,
   int16_t h, int16_t r, uint16_t color) {
-  // smarter version
-  drawFastHLine(x+r  , y    , w-2*r, color); // Top
-  drawFastHLine(x+r  , y+h-1, w-2*r, color); // Bottom
-  drawFastVLine(x    , y+r  , h-2*r, color); // Left
-  drawFastVLine(x+w-1, y+r  , h-2*r, color); // Right
-  // draw four corners
-  drawCircleHelper(x+r    , y+r    , r, 1, color);
-  drawCircleHelper(x+w-r-1, y+r    , r, 2, color);
-  drawCircleHelper(x+w-r-1, y+h-r-1, r, 4, color);
-  drawCircleHelper(x+r    , y+h-r-1, r, 8, color);
+  Raster::drawRoundRect(*this, x, y, w, h, r, color);
 }
 
 // Fill a rounded rectangle
 void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w,
 				 int16_t h, int16_t r, uint16_t color) {
-  // smarter version
-  fillRect(x+r, y, w-2*r, h, color);
-
-  // draw four corners
-  fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
-  fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+  Raster::fillRoundRect(*this, x, y, w, h, r, color);
 }
 
 // Draw a triangle
 void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0,
 				int16_t x1, int16_t y1,
 				int16_t x2, int16_t y2, uint16_t color) {
-  drawLine(x0, y0, x1, y1, color);
-  drawLine(x1, y1, x2, y2, color);
-  drawLine(x2, y2, x0, y0, color);
+  Raster::drawTriangle(*this, x0, y0, x1, y1, x2, y2, color);
 }
 
 // Fill a triangle
 void Adafruit_GFX::fillTriangle ( int16_t x0, int16_t y0,
 				  int16_t x1, int16_t y1,
 				  int16_t x2, int16_t y2, uint16_t color) {
-
-  int16_t a, b, y, last;
-
-  // Sort coordinates by Y order (y2 >= y1 >= y0)
-  if (y0 > y1) {
-    swap(y0, y1); swap(x0, x1);
-  }
-  if (y1 > y2) {
-    swap(y2, y1); swap(x2, x1);
-  }
-  if (y0 > y1) {
-    swap(y0, y1); swap(x0, x1);
-  }
-
-  if(y0 == y2) { // Handle awkward all-on-same-line case as its own thing
-    a = b = x0;
-    if(x1 < a)      a = x1;
-    else if(x1 > b) b = x1;
-    if(x2 < a)      a = x2;
-    else if(x2 > b) b = x2;
-    drawFastHLine(a, y0, b-a+1, color);
-    return;
-  }
-
-  int16_t
-    dx01 = x1 - x0,
-    dy01 = y1 - y0,
-    dx02 = x2 - x0,
-    dy02 = y2 - y0,
-    dx12 = x2 - x1,
-    dy12 = y2 - y1,
-    sa   = 0,
-    sb   = 0;
-
-  // For upper part of triangle, find scanline crossings for segments
-  // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
-  if(y1 == y2) last = y1;   // Include y1 scanline
-  else         last = y1-1; // Skip it
-
-  for(y=y0; y<=last; y++) {
-    a   = x0 + sa / dy01;
-    b   = x0 + sb / dy02;
-    sa += dx01;
-    sb += dx02;
-    /* longhand:
-    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if(a > b) swap(a,b);
-    drawFastHLine(a, y, b-a+1, color);
-  }
-
-  // For lower part of triangle, find scanline crossings for segments
-  // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = dx12 * (y - y1);
-  sb = dx02 * (y - y0);
-  for(; y<=y2; y++) {
-    a   = x1 + sa / dy12;
-    b   = x0 + sb / dy02;
-    sa += dx12;
-    sb += dx02;
-    /* longhand:
-    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if(a > b) swap(a,b);
-    drawFastHLine(a, y, b-a+1, color);
-  }
+  Raster::fillTriangle(*this, x0, y0, x1, y1, x2, y2, color);
 }
 
 void Adafruit_GFX::drawBitmap(int16_t x, int16_t y,
 			      const uint8_t *bitmap, int16_t w, int16_t h,
 			      uint16_t color) {
-
-  int16_t i, j, byteWidth = (w + 7) / 8;
-
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++ ) {
-      if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-	drawPixel(x+i, y+j, color);
-      }
-    }
-  }
+  Raster::drawBitmap(*this, x, y, bitmap, w, h, color);
 }
 
 #if ARDUINO >= 100
@@ -386,39 +178,95 @@ void Adafruit_GFX::write(uint8_t c) {
 #endif
 }
 
-// Draw a character
-void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
-			    uint16_t color, uint16_t bg, uint8_t size) {
+#if ARDUINO >= 100
+size_t Adafruit_GFX::write(const uint8_t *buffer, size_t size) {
+  const uint8_t *end = buffer + size;
 
-  if((x >= _width)            || // Clip right
-     (y >= _height)           || // Clip bottom
-     ((x + 6 * size - 1) < 0) || // Clip left
-     ((y + 8 * size - 1) < 0))   // Clip top
-    return;
-
-  for (int8_t i=0; i<6; i++ ) {
-    uint8_t line;
-    if (i == 5) 
-      line = 0x0;
-    else 
-      line = pgm_read_byte(font+(c*5)+i);
-    for (int8_t j = 0; j<8; j++) {
-      if (line & 0x1) {
-        if (size == 1) // default size
-          drawPixel(x+i, y+j, color);
-        else {  // big size
-          fillRect(x+(i*size), y+(j*size), size, size, color);
-        } 
-      } else if (bg != color) {
-        if (size == 1) // default size
-          drawPixel(x+i, y+j, bg);
-        else {  // big size
-          fillRect(x+i*size, y+j*size, size, size, bg);
+  while (buffer < end) {
+    if (*buffer == '\n') {
+      cursor_y += textsize*8;
+      cursor_x  = 0;
+      buffer++;
+    } else if (*buffer == '\r') {
+      // skip em
+      buffer++;
+    } else {
+      // the characters up to the next control character or wrap point
+      const uint8_t *run = buffer;
+      int16_t x = cursor_x;
+      boolean wrapped = false;
+      while (buffer < end && *buffer != '\n' && *buffer != '\r') {
+        buffer++;
+        cursor_x += textsize*6;
+        if (wrap && (cursor_x > (_width - textsize*6))) {
+          wrapped = true;
+          break;
         }
       }
-      line >>= 1;
+      if (cursor_y <= clip_y1 && cursor_y + textsize*8 - 1 >= clip_y0)
+        drawChars(x, cursor_y, run, buffer - run, textcolor, textbgcolor,
+          textsize);
+      if (wrapped) {
+        cursor_y += textsize*8;
+        cursor_x  = 0;
+      }
+    }
+  }
+  return size;
+}
+#endif
+
+void Adafruit_GFX::getTextBounds(const char *string, int16_t x, int16_t y,
+    int font, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -0x8000, maxy = -0x8000;
+  int16_t cx = x, cy = y;
+
+  // the cursor moves as in write()
+  if (font == 1) while (*string) {
+    char c = *string++;
+    if (c == '\n') {
+      cy += textsize*8;
+      cx = 0;
+    } else if (c != '\r') {
+      if (cx < minx) minx = cx;
+      if (cy < miny) miny = cy;
+      if (cx + textsize*6 - 1 > maxx) maxx = cx + textsize*6 - 1;
+      if (cy + textsize*8 - 1 > maxy) maxy = cy + textsize*8 - 1;
+      cx += textsize*6;
+      if (wrap && (cx > (_width - textsize*6))) {
+        cy += textsize*8;
+        cx = 0;
+      }
     }
   }
+  if (maxx < minx) {
+    *x1 = x;
+    *y1 = y;
+    *w  = *h = 0;
+  } else {
+    *x1 = minx;
+    *y1 = miny;
+    *w  = maxx - minx + 1;
+    *h  = maxy - miny + 1;
+  }
+}
+
+// Draw a character
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
+			    uint16_t color, uint16_t bg, uint8_t size) {
+  Raster::drawChar(*this, x, y, c, color, bg, size);
+}
+
+void Adafruit_GFX::drawChars(int16_t x, int16_t y, const uint8_t *chars,
+    size_t n, uint16_t color, uint16_t bg, uint8_t size) {
+  for (; n > 0 && x <= clip_x1; n--, chars++, x += size*6) {
+    if (x + size*6 - 1 >= clip_x0)
+      drawChar(x, y, *chars, color, bg, size);
+  }
+}
+
+const unsigned char *Adafruit_GFX::glcdfont(void) {
+  return font;
 }
 
 void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
@@ -463,6 +311,52 @@ void Adafruit_GFX::setRotation(uint8_t x) {
     _height = WIDTH;
     break;
   }
+  resetClip();
+}
+
+boolean Adafruit_GFX::pushClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (clip_depth >= GFX_CLIP_DEPTH) return false;
+  int16_t *saved = clip_stack[clip_depth++];
+  saved[0] = clip_x0;
+  saved[1] = clip_y0;
+  saved[2] = clip_x1;
+  saved[3] = clip_y1;
+  // an empty intersection leaves x0 > x1 (or y0 > y1), nothing is inside
+  if (x > clip_x0)     clip_x0 = x;
+  if (y > clip_y0)     clip_y0 = y;
+  if (x+w-1 < clip_x1) clip_x1 = x+w-1;
+  if (y+h-1 < clip_y1) clip_y1 = y+h-1;
+  return true;
+}
+
+void Adafruit_GFX::popClip(void) {
+  if (clip_depth == 0) return;
+  int16_t *saved = clip_stack[--clip_depth];
+  clip_x0 = saved[0];
+  clip_y0 = saved[1];
+  clip_x1 = saved[2];
+  clip_y1 = saved[3];
+}
+
+void Adafruit_GFX::resetClip(void) {
+  clip_x0    = 0;
+  clip_y0    = 0;
+  clip_x1    = _width - 1;
+  clip_y1    = _height - 1;
+  clip_depth = 0;
+}
+
+boolean Adafruit_GFX::clipRect(int16_t &x, int16_t &y, int16_t &w,
+			       int16_t &h) {
+  int16_t x1 = x + w - 1, y1 = y + h - 1;
+  if (x < clip_x0)  x  = clip_x0;
+  if (y < clip_y0)  y  = clip_y0;
+  if (x1 > clip_x1) x1 = clip_x1;
+  if (y1 > clip_y1) y1 = clip_y1;
+  if (x > x1 || y > y1) return false;
+  w = x1 - x + 1;
+  h = y1 - y + 1;
+  return true;
 }
 
 // Return the size of the display (per current rotation)
@@ -10,6 +10,12 @@
 
 #define swap(a, b) { int16_t t = a; a = b; b = t; }
 
+#ifndef GFX_CLIP_DEPTH
+ #define GFX_CLIP_DEPTH 4 // How many pushClip() rectangles can nest
+#endif
+
+template <class Device> class Adafruit_GFX_Raster;
+
 class Adafruit_GFX : public Print {
 
  public:
@@ -30,14 +36,16 @@ class Adafruit_GFX : public Print {
     fillScreen(uint16_t color),
     invertDisplay(boolean i);
 
-  // These exist only with Adafruit_GFX (no subclass overrides)
-  void
+  // Horizontal run of pixels x0..x1 on row y, every fill primitive draws
+  // through this.  The default is drawFastHLine().
+  virtual void
+    drawSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color);
+
+  // Subclasses that inline drawPixel() can override these with
+  // Adafruit_GFX_Raster<Subclass> (see Adafruit_GFX_Raster.h).
+  virtual void
     drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
-    drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
-      uint16_t color),
     fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color),
-    fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
-      int16_t delta, uint16_t color),
     drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
       int16_t x2, int16_t y2, uint16_t color),
     fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
@@ -50,6 +58,18 @@ class Adafruit_GFX : public Print {
       int16_t w, int16_t h, uint16_t color),
     drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       uint16_t bg, uint8_t size),
+    // n characters side by side, the text runs of write() are drawn with
+    // this.  The default calls drawChar() for the ones inside the clip
+    // rectangle.
+    drawChars(int16_t x, int16_t y, const uint8_t *chars, size_t n,
+      uint16_t color, uint16_t bg, uint8_t size);
+
+  // These exist only with Adafruit_GFX (no subclass overrides)
+  void
+    drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+      uint16_t color),
+    fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+      int16_t delta, uint16_t color),
     setCursor(int16_t x, int16_t y),
     setTextColor(uint16_t c),
     setTextColor(uint16_t c, uint16_t bg),
@@ -59,17 +79,85 @@ class Adafruit_GFX : public Print {
 
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
+  // A whole string at a time: lines and wrap points are laid out first,
+  // each line is clip tested once and drawn with drawChars().
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
 #else
   virtual void   write(uint8_t);
 #endif
 
+  // The box print(string) would cover starting at x,y, without drawing,
+  // with the same line breaks and wrapping.  The font numbers are those of
+  // Adafruit_GFX_AS; this core has font 1, the 5x7 font, at the current
+  // text size.  Nothing to draw is 0 wide and high at x,y.
+  void getTextBounds(const char *string, int16_t x, int16_t y, int font,
+      int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h);
+
   int16_t
     height(void),
     width(void);
 
   uint8_t getRotation(void);
 
+  // Clipping.  The primitives only touch pixels inside the clip rectangle,
+  // which is the whole display until pushClip() narrows it to the part of
+  // x,y,w,h inside the current one; popClip() goes back to the one before.
+  // pushClip() returns false and changes nothing when GFX_CLIP_DEPTH
+  // rectangles are pushed already.  setRotation() resets the stack.
+  // A subclass that overrides drawPixel() or the line/fill functions gets
+  // its calls clipped already when they come from another primitive, its
+  // own overrides are expected to clip direct calls themselves.
+  boolean pushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+  void popClip(void);
+  virtual void resetClip(void); // The whole display, empties the stack
+  boolean inClip(int16_t x, int16_t y) {
+    return x >= clip_x0 && x <= clip_x1 && y >= clip_y0 && y <= clip_y1;
+  }
+
+  // The 5x7 font in PROGMEM, 5 bytes per character.
+  static const unsigned char *glcdfont(void);
+
+  // Pixel and span hooks of Adafruit_GFX_Raster<Adafruit_GFX>, they clip
+  // and go through the virtual functions.  The NoClip ones are for pixels
+  // known to be inside the clip rectangle.
+  enum { RasterVertical = 0 };
+  void rasterPixel(int16_t x, int16_t y, uint16_t color) {
+    if (inClip(x, y)) drawPixel(x, y, color);
+  }
+  void rasterPixelNoClip(int16_t x, int16_t y, uint16_t color) {
+    drawPixel(x, y, color);
+  }
+  void rasterSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color) {
+    if (y < clip_y0 || y > clip_y1) return;
+    if (x0 < clip_x0) x0 = clip_x0;
+    if (x1 > clip_x1) x1 = clip_x1;
+    if (x0 <= x1) drawSpan(y, x0, x1, color);
+  }
+  void rasterSpanNoClip(int16_t y, int16_t x0, int16_t x1, uint16_t color) {
+    if (x0 <= x1) drawSpan(y, x0, x1, color);
+  }
+  void rasterHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    int16_t h = 1;
+    if (clipRect(x, y, w, h)) drawFastHLine(x, y, w, color);
+  }
+  void rasterVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    int16_t w = 1;
+    if (clipRect(x, y, w, h)) drawFastVLine(x, y, h, color);
+  }
+  void rasterVLineNoClip(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (h > 0) drawFastVLine(x, y, h, color);
+  }
+  void rasterFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (clipRect(x, y, w, h)) fillRect(x, y, w, h, color);
+  }
+
  protected:
+  // Cut x,y,w,h down to the clip rectangle, false if nothing is left.
+  boolean clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+
+  template <class Device> friend class Adafruit_GFX_Raster;
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
@@ -82,6 +170,11 @@ class Adafruit_GFX : public Print {
     rotation;
   boolean
     wrap; // If set, 'wrap' text at right edge of display
+  int16_t
+    clip_x0, clip_y0, clip_x1, clip_y1, // Clip rectangle, inclusive
+    clip_stack[GFX_CLIP_DEPTH][4];      // The ones pushClip() replaced
+  uint8_t
+    clip_depth;
 };
 
 #endif // _ADAFRUIT_GFX_H
@@ -0,0 +1,583 @@
+#ifndef _ADAFRUIT_GFX_RASTER_H
+#define _ADAFRUIT_GFX_RASTER_H
+
+#include "Adafruit_GFX.h"
+#ifdef __AVR__
+ #include <avr/pgmspace.h>
+#elif !defined(pgm_read_byte)
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+
+// The drawing algorithms of Adafruit_GFX, parameterised on the display type.
+// Device provides rasterPixel(), rasterSpan(), rasterHLine(), rasterVLine()
+// and rasterFill(), which clip to the clip rectangle of Adafruit_GFX, and
+// rasterPixelNoClip(), rasterSpanNoClip() and rasterVLineNoClip(), which
+// don't.  They are looked up on the static type, so for a concrete display
+// with inline versions the pixel and span writes inline into the loops
+// below.  Adafruit_GFX itself uses Adafruit_GFX_Raster<Adafruit_GFX>, whose
+// hooks are the virtual drawPixel() & co.
+//
+// Every primitive first tests its bounding box against the clip rectangle:
+// outside it returns before any work, inside it draws through the NoClip
+// hooks, and only a primitive across an edge pays for clipping each run.
+// The line, triangle and bitmap loops also skip the rows and columns that
+// are outside.
+//
+// Fills go out as horizontal spans (rasterSpan) unless Device::RasterVertical
+// is set; a display that keeps 8 rows in a byte fills whole columns far
+// cheaper than rows, and gets vertical runs (rasterVLine) instead.
+template <class Device>
+class Adafruit_GFX_Raster {
+
+ public:
+
+  enum { ClipOutside, ClipPartial, ClipInside };
+
+  // Where the box x0..x1, y0..y1 lies against the clip rectangle of d.
+  static uint8_t clipTest(Device &d, int16_t x0, int16_t y0,
+      int16_t x1, int16_t y1) {
+    if (x0 > x1) swap(x0, x1);
+    if (y0 > y1) swap(y0, y1);
+    if (x1 < d.clip_x0 || x0 > d.clip_x1 || y1 < d.clip_y0 || y0 > d.clip_y1)
+      return ClipOutside;
+    if (x0 >= d.clip_x0 && x1 <= d.clip_x1 &&
+        y0 >= d.clip_y0 && y1 <= d.clip_y1)
+      return ClipInside;
+    return ClipPartial;
+  }
+
+  // Bresenham's algorithm - thx wikpedia
+  static void drawLine(Device &d, int16_t x0, int16_t y0,
+      int16_t x1, int16_t y1, uint16_t color) {
+    uint8_t clip = clipTest(d, x0, y0, x1, y1);
+    if (clip == ClipOutside) return;
+
+    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      swap(x0, y0);
+      swap(x1, y1);
+    }
+
+    if (x0 > x1) {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+
+    int16_t dx, dy;
+    dx = x1 - x0;
+    dy = abs(y1 - y0);
+
+    int16_t err = dx / 2;
+    int16_t ystep;
+
+    if (y0 < y1) {
+      ystep = 1;
+    } else {
+      ystep = -1;
+    }
+
+    if (clip == ClipInside) {
+      for (; x0<=x1; x0++) {
+        if (steep) {
+          d.rasterPixelNoClip(y0, x0, color);
+        } else {
+          d.rasterPixelNoClip(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+          y0 += ystep;
+          err += dx;
+        }
+      }
+      return;
+    }
+
+    // Only the steps along the long axis inside the clip rectangle, the
+    // ones before it are skipped in one go (err stays within 0..dx-1).
+    int16_t lo = steep ? d.clip_y0 : d.clip_x0;
+    int16_t hi = steep ? d.clip_y1 : d.clip_x1;
+    if (x1 > hi) x1 = hi;
+    if (x0 < lo) {
+      int32_t e = err - (int32_t)(lo - x0) * dy;
+      if (e < 0) {
+        int32_t n = (dx - 1 - e) / dx;
+        y0 += ystep * n;
+        e  += n * dx;
+      }
+      err = e;
+      x0  = lo;
+    }
+
+    for (; x0<=x1; x0++) {
+      if (steep) {
+        d.rasterPixel(y0, x0, color);
+      } else {
+        d.rasterPixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  // Draw a rectangle
+  static void drawRect(Device &d, int16_t x, int16_t y,
+      int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0 || clipTest(d, x, y, x+w-1, y+h-1) == ClipOutside)
+      return;
+    d.rasterHLine(x, y, w, color);
+    d.rasterHLine(x, y+h-1, w, color);
+    d.rasterVLine(x, y, h, color);
+    d.rasterVLine(x+w-1, y, h, color);
+  }
+
+  // Draw a circle outline.  The octant points are collected into the
+  // horizontal runs they form near the top and bottom and the vertical runs
+  // near the sides, one run per value of y.
+  static void drawCircle(Device &d, int16_t x0, int16_t y0, int16_t r,
+      uint16_t color) {
+    if (clipTest(d, x0-r, y0-r, x0+r, y0+r) == ClipOutside) return;
+    d.rasterPixel(x0  , y0+r, color);
+    d.rasterPixel(x0  , y0-r, color);
+    d.rasterPixel(x0+r, y0  , color);
+    d.rasterPixel(x0-r, y0  , color);
+    drawCircleHelper(d, x0, y0, r, 0xF, color);
+  }
+
+  static void drawCircleHelper(Device &d, int16_t x0, int16_t y0,
+      int16_t r, uint8_t cornername, uint16_t color) {
+    uint8_t clip = clipTest(d, x0-r, y0-r, x0+r, y0+r);
+    if (clip == ClipInside)
+      circleRuns<false>(d, x0, y0, r, cornername, color);
+    else if (clip == ClipPartial)
+      circleRuns<true>(d, x0, y0, r, cornername, color);
+  }
+
+  static void fillCircle(Device &d, int16_t x0, int16_t y0, int16_t r,
+      uint16_t color) {
+    uint8_t clip = clipTest(d, x0-r, y0-r, x0+r, y0+r);
+    if (clip == ClipOutside) return;
+    if (Device::RasterVertical) {
+      d.rasterVLine(x0, y0-r, 2*r+1, color);
+      fillCircleHelper(d, x0, y0, r, 3, 0, color);
+    } else if (clip == ClipInside) {
+      fillArcs<false>(d, x0, x0, y0, r, 0, color);
+    } else {
+      fillArcs<true>(d, x0, x0, y0, r, 0, color);
+    }
+  }
+
+  // Used to do circles and roundrects
+  static void fillCircleHelper(Device &d, int16_t x0, int16_t y0, int16_t r,
+      uint8_t cornername, int16_t delta, uint16_t color) {
+    uint8_t clip = clipTest(d, x0-r, y0-r + (delta < 0 ? delta : 0),
+      x0+r, y0+r + (delta > 0 ? delta : 0));
+    if (clip == ClipInside) {
+      fillCorners<false>(d, x0, y0, r, cornername, delta, color);
+    } else if (clip == ClipPartial) {
+      // a half that is off to the side of the clip rectangle draws nothing
+      if (x0 > d.clip_x1 || x0 + r < d.clip_x0) cornername &= ~0x1;
+      if (x0 < d.clip_x0 || x0 - r > d.clip_x1) cornername &= ~0x2;
+      fillCorners<true>(d, x0, y0, r, cornername, delta, color);
+    }
+  }
+
+  // Draw a rounded rectangle
+  static void drawRoundRect(Device &d, int16_t x, int16_t y, int16_t w,
+      int16_t h, int16_t r, uint16_t color) {
+    // at most half the shorter side as upstream, nor negative, so that
+    // nothing is drawn outside of x, y, w, h
+    int16_t maxr = (w < h ? w : h) / 2;
+    if (r > maxr) r = maxr;
+    if (r < 0) r = 0;
+    uint8_t clip = ClipOutside;
+    if (w > 0 && h > 0) clip = clipTest(d, x, y, x+w-1, y+h-1);
+    if (clip == ClipOutside) return;
+    if (clip == ClipInside)
+      roundRectOutline<false>(d, x, y, w, h, r, color);
+    else
+      roundRectOutline<true>(d, x, y, w, h, r, color);
+  }
+
+  // Fill a rounded rectangle
+  static void fillRoundRect(Device &d, int16_t x, int16_t y, int16_t w,
+      int16_t h, int16_t r, uint16_t color) {
+    // at most half the shorter side as upstream, nor negative, so that
+    // nothing is drawn outside of x, y, w, h
+    int16_t maxr = (w < h ? w : h) / 2;
+    if (r > maxr) r = maxr;
+    if (r < 0) r = 0;
+    uint8_t clip = ClipOutside;
+    if (w > 0 && h > 0) clip = clipTest(d, x, y, x+w-1, y+h-1);
+    if (clip == ClipOutside) return;
+    if (Device::RasterVertical) {
+      // smarter version
+      d.rasterFill(x+r, y, w-2*r, h, color);
+
+      // draw four corners
+      fillCircleHelper(d, x+w-r-1, y+r, r, 1, h-2*r-1, color);
+      fillCircleHelper(d, x+r    , y+r, r, 2, h-2*r-1, color);
+    } else {
+      // the straight part in one go, the rounded rows as full width spans
+      d.rasterFill(x, y+r, w, h-2*r, color);
+      if (clip == ClipInside)
+        fillArcs<false>(d, x+r, x+w-r-1, y+r, r, h-2*r-1, color);
+      else
+        fillArcs<true>(d, x+r, x+w-r-1, y+r, r, h-2*r-1, color);
+    }
+  }
+
+  // Draw a triangle
+  static void drawTriangle(Device &d, int16_t x0, int16_t y0,
+      int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    drawLine(d, x0, y0, x1, y1, color);
+    drawLine(d, x1, y1, x2, y2, color);
+    drawLine(d, x2, y2, x0, y0, color);
+  }
+
+  // Fill a triangle
+  static void fillTriangle(Device &d, int16_t x0, int16_t y0,
+      int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+
+    int16_t a, b;
+
+    // Sort coordinates by Y order (y2 >= y1 >= y0)
+    if (y0 > y1) {
+      swap(y0, y1); swap(x0, x1);
+    }
+    if (y1 > y2) {
+      swap(y2, y1); swap(x2, x1);
+    }
+    if (y0 > y1) {
+      swap(y0, y1); swap(x0, x1);
+    }
+
+    a = b = x0;
+    if(x1 < a)      a = x1;
+    else if(x1 > b) b = x1;
+    if(x2 < a)      a = x2;
+    else if(x2 > b) b = x2;
+    uint8_t clip = clipTest(d, a, y0, b, y2);
+    if (clip == ClipInside)
+      triangleSpans<false>(d, x0, y0, x1, y1, x2, y2, a, b, color);
+    else if (clip == ClipPartial)
+      triangleSpans<true>(d, x0, y0, x1, y1, x2, y2, a, b, color);
+  }
+
+  static void drawBitmap(Device &d, int16_t x, int16_t y,
+      const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    int16_t i0 = 0, j0 = 0, i1 = w, j1 = h;
+
+    if (w <= 0 || h <= 0 || clipTest(d, x, y, x+w-1, y+h-1) == ClipOutside)
+      return;
+    // only the rows and columns inside the clip rectangle
+    if (x < d.clip_x0)       i0 = d.clip_x0 - x;
+    if (y < d.clip_y0)       j0 = d.clip_y0 - y;
+    if (x+w-1 > d.clip_x1)   i1 = d.clip_x1 - x + 1;
+    if (y+h-1 > d.clip_y1)   j1 = d.clip_y1 - y + 1;
+
+    for(j=j0; j<j1; j++) {
+      for(i=i0; i<i1; i++ ) {
+        if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
+          d.rasterPixelNoClip(x+i, y+j, color);
+        }
+      }
+    }
+  }
+
+  // Draw a character of the 5x7 font
+  static void drawChar(Device &d, int16_t x, int16_t y, unsigned char c,
+      uint16_t color, uint16_t bg, uint8_t size) {
+
+    uint8_t clip = clipTest(d, x, y, x + 6 * size - 1, y + 8 * size - 1);
+    if (clip == ClipOutside)
+      return;
+
+    const unsigned char *glyph = Adafruit_GFX::glcdfont() + c*5;
+    for (int8_t i=0; i<6; i++ ) {
+      uint8_t line;
+      if (i == 5)
+        line = 0x0;
+      else
+        line = pgm_read_byte(glyph+i);
+      for (int8_t j = 0; j<8; j++) {
+        if (line & 0x1) {
+          if (size == 1) { // default size
+            if (clip == ClipInside) d.rasterPixelNoClip(x+i, y+j, color);
+            else                    d.rasterPixel(x+i, y+j, color);
+          } else {  // big size
+            d.rasterFill(x+(i*size), y+(j*size), size, size, color);
+          }
+        } else if (bg != color) {
+          if (size == 1) { // default size
+            if (clip == ClipInside) d.rasterPixelNoClip(x+i, y+j, bg);
+            else                    d.rasterPixel(x+i, y+j, bg);
+          } else {  // big size
+            d.rasterFill(x+i*size, y+j*size, size, size, bg);
+          }
+        }
+        line >>= 1;
+      }
+    }
+  }
+
+ private:
+
+  // The sides and corners of drawRoundRect().
+  template <bool Clip>
+  static void roundRectOutline(Device &d, int16_t x, int16_t y, int16_t w,
+      int16_t h, int16_t r, uint16_t color) {
+    // smarter version
+    span<Clip>(d, y    , x+r, x+w-r-1, color); // Top
+    span<Clip>(d, y+h-1, x+r, x+w-r-1, color); // Bottom
+    vline<Clip>(d, x    , y+r, h-2*r, color);  // Left
+    vline<Clip>(d, x+w-1, y+r, h-2*r, color);  // Right
+    // draw four corners
+    circleRuns<Clip>(d, x+r    , y+r    , r, 1, color);
+    circleRuns<Clip>(d, x+w-r-1, y+r    , r, 2, color);
+    circleRuns<Clip>(d, x+w-r-1, y+h-r-1, r, 4, color);
+    circleRuns<Clip>(d, x+r    , y+h-r-1, r, 8, color);
+  }
+
+  // The runs of drawCircleHelper().
+  template <bool Clip>
+  static void circleRuns(Device &d, int16_t x0, int16_t y0, int16_t r,
+      uint8_t cornername, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t xs    = 1; // first x of the run on this y
+
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      // flush the run when y changes on the next step or the loop ends
+      if (f >= 0 || x >= y) {
+        int16_t n = x - xs + 1;
+        if (cornername & 0x4) {
+          span<Clip>(d, y0 + y, x0 + xs, x0 + x, color);
+          vline<Clip>(d, x0 + y, y0 + xs, n, color);
+        }
+        if (cornername & 0x2) {
+          span<Clip>(d, y0 - y, x0 + xs, x0 + x, color);
+          vline<Clip>(d, x0 + y, y0 - x, n, color);
+        }
+        if (cornername & 0x8) {
+          vline<Clip>(d, x0 - y, y0 + xs, n, color);
+          span<Clip>(d, y0 + y, x0 - x, x0 - xs, color);
+        }
+        if (cornername & 0x1) {
+          vline<Clip>(d, x0 - y, y0 - x, n, color);
+          span<Clip>(d, y0 - y, x0 - x, x0 - xs, color);
+        }
+        xs = x + 1;
+      }
+    }
+  }
+
+  // The columns of fillCircleHelper().  Without RasterVertical they
+  // are emitted as the horizontal spans they cover: column x0+c runs
+  // from y0-h to y0+h+delta, so row y0-t (and y0+delta+t) covers every
+  // column whose h is at least t.  The Bresenham steps give those widths
+  // directly, (x,y) is h=y for column x and h=x for column y.
+  template <bool Clip>
+  static void fillCorners(Device &d, int16_t x0, int16_t y0, int16_t r,
+      uint8_t cornername, int16_t delta, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+    int16_t lo, w = 0;
+
+    if (Device::RasterVertical) {
+      while (x<y) {
+        if (f >= 0) {
+          y--;
+          ddF_y += 2;
+          f     += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f     += ddF_x;
+
+        if (cornername & 0x1) {
+          vline<Clip>(d, x0+x, y0-y, 2*y+1+delta, color);
+          vline<Clip>(d, x0+y, y0-x, 2*x+1+delta, color);
+        }
+        if (cornername & 0x2) {
+          vline<Clip>(d, x0-x, y0-y, 2*y+1+delta, color);
+          vline<Clip>(d, x0-y, y0-x, 2*x+1+delta, color);
+        }
+      }
+      return;
+    }
+
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      if (w == 0) w = y > x ? y : x; // widest, for the rows in the middle
+
+      // y only reaches 0 for r=1, then column x0 itself is part of it
+      lo = y ? 1 : 0;
+      if (cornername & 0x1) {
+        span<Clip>(d, y0 - x, x0 + lo, x0 + y, color);
+        span<Clip>(d, y0 + x + delta, x0 + lo, x0 + y, color);
+        if (f >= 0 || x >= y) {
+          span<Clip>(d, y0 - y, x0 + lo, x0 + x, color);
+          span<Clip>(d, y0 + y + delta, x0 + lo, x0 + x, color);
+        }
+      }
+      if (cornername & 0x2) {
+        span<Clip>(d, y0 - x, x0 - y, x0 - lo, color);
+        span<Clip>(d, y0 + x + delta, x0 - y, x0 - lo, color);
+        if (f >= 0 || x >= y) {
+          span<Clip>(d, y0 - y, x0 - x, x0 - lo, color);
+          span<Clip>(d, y0 + y + delta, x0 - x, x0 - lo, color);
+        }
+      }
+    }
+    if (w) {
+      lo = (r == 1) ? 0 : 1;
+      for (int16_t i=0; i<=delta; i++) {
+        if (cornername & 0x1) span<Clip>(d, y0 + i, x0 + lo, x0 + w, color);
+        if (cornername & 0x2) span<Clip>(d, y0 + i, x0 - w, x0 - lo, color);
+      }
+    }
+  }
+
+  // The scanlines of fillTriangle(), y0 <= y1 <= y2 and a..b the columns.
+  template <bool Clip>
+  static void triangleSpans(Device &d, int16_t x0, int16_t y0,
+      int16_t x1, int16_t y1, int16_t x2, int16_t y2,
+      int16_t a, int16_t b, uint16_t color) {
+
+    int16_t y, last;
+
+    if(y0 == y2) { // Handle awkward all-on-same-line case as its own thing
+      span<Clip>(d, y0, a, b, color);
+      return;
+    }
+
+    int16_t
+      dx01 = x1 - x0,
+      dy01 = y1 - y0,
+      dx02 = x2 - x0,
+      dy02 = y2 - y0,
+      dx12 = x2 - x1,
+      dy12 = y2 - y1;
+    // 32 bits, dx*dy is past int16_t on anything bigger than 128x64
+    int32_t
+      sa   = 0,
+      sb   = 0;
+
+    // For upper part of triangle, find scanline crossings for segments
+    // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
+    // is included here (and second loop will be skipped, avoiding a /0
+    // error there), otherwise scanline y1 is skipped here and handled
+    // in the second loop...which also avoids a /0 error here if y0=y1
+    // (flat-topped triangle).
+    if(y1 == y2) last = y1;   // Include y1 scanline
+    else         last = y1-1; // Skip it
+
+    // Start at the top of the clip rectangle and stop at its bottom, the
+    // crossings are dx*(y-y0) either way.
+    y = y0;
+    if (Clip) {
+      if(y < d.clip_y0)    y    = d.clip_y0;
+      if(last > d.clip_y1) last = d.clip_y1;
+      if(y2 > d.clip_y1)   y2   = d.clip_y1;
+    }
+    sa = (int32_t)dx01 * (y - y0);
+    sb = (int32_t)dx02 * (y - y0);
+    for(; y<=last; y++) {
+      a   = x0 + sa / dy01;
+      b   = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if(a > b) swap(a,b);
+      span<Clip>(d, y, a, b, color);
+    }
+
+    // For lower part of triangle, find scanline crossings for segments
+    // 0-2 and 1-2.  This loop is skipped if y1=y2.
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for(; y<=y2; y++) {
+      a   = x1 + sa / dy12;
+      b   = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if(a > b) swap(a,b);
+      span<Clip>(d, y, a, b, color);
+    }
+  }
+
+  // Both halves of fillCircleHelper() with everything between columns xl
+  // and xr, one span per row.  Rows y0..y0+delta are left to the caller.
+  template <bool Clip>
+  static void fillArcs(Device &d, int16_t xl, int16_t xr,
+      int16_t y0, int16_t r, int16_t delta, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+
+    if (delta == 0) span<Clip>(d, y0, xl - r, xr + r, color);
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+
+      // for r=1 the corners are the columns xl and xr themselves, which
+      // may be the wrong way round for a roundrect with w = 2
+      int16_t e = y ? y : (xl > xr);
+      span<Clip>(d, y0 - x, xl - e, xr + e, color);
+      span<Clip>(d, y0 + x + delta, xl - e, xr + e, color);
+      if ((f >= 0 || x >= y) && y != x && (y || delta >= 0)) {
+        span<Clip>(d, y0 - y, xl - x, xr + x, color);
+        span<Clip>(d, y0 + y + delta, xl - x, xr + x, color);
+      }
+    }
+  }
+
+  // The span hooks, clipped or not.
+  template <bool Clip>
+  static void span(Device &d, int16_t y, int16_t x0, int16_t x1,
+      uint16_t color) {
+    if (Clip) d.rasterSpan(y, x0, x1, color);
+    else      d.rasterSpanNoClip(y, x0, x1, color);
+  }
+  template <bool Clip>
+  static void vline(Device &d, int16_t x, int16_t y, int16_t h,
+      uint16_t color) {
+    if (Clip) d.rasterVLine(x, y, h, color);
+    else      d.rasterVLineNoClip(x, y, h, color);
+  }
+};
+
+#endif // _ADAFRUIT_GFX_RASTER_H
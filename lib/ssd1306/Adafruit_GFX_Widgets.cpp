@@ -0,0 +1,125 @@
+#include "Adafruit_GFX_Widgets.h"
+#include <stdio.h>
+#include <string.h>
+
+GFX_Widget::GFX_Widget(int16_t x, int16_t y, int16_t w, int16_t h):
+  _x(x), _y(y), _w(w), _h(h), changed(true), valid(false)
+{
+}
+
+boolean GFX_Widget::draw(Adafruit_GFX &gfx) {
+  if (!changed) return false;
+  // a full clip stack draws nothing rather than outside the bounds
+  if (!gfx.pushClip(_x, _y, _w, _h)) return false;
+  render(gfx, !valid);
+  gfx.popClip();
+  changed = false;
+  valid   = true;
+  return true;
+}
+
+GFX_Text::GFX_Text(int16_t x, int16_t y, uint8_t cells, uint8_t size,
+    uint16_t color, uint16_t bg):
+  GFX_Widget(x, y, 0, 8*size), size(size), color(color), bg(bg)
+{
+  if (cells > GFX_TEXT_MAX) cells = GFX_TEXT_MAX;
+  this->cells = cells;
+  _w = cells*6*size;
+  _text[0] = 0;
+}
+
+void GFX_Text::setText(const char *text) {
+  if (strncmp(_text, text, cells) == 0) return;
+  strncpy(_text, text, cells);
+  _text[cells] = 0;
+  changed = true;
+}
+
+void GFX_Text::setColor(uint16_t color, uint16_t bg) {
+  if (color == this->color && bg == this->bg) return;
+  this->color = color;
+  this->bg    = bg;
+  invalidate();
+}
+
+void GFX_Text::render(Adafruit_GFX &gfx, boolean all) {
+  uint8_t i, start, len = strlen(_text);
+
+  // runs of cells that differ from the display, blanks past the text
+  for (i = 0; i < cells; ) {
+    char c = i < len ? _text[i] : ' ';
+    if (!all && drawn[i] == c) {
+      i++;
+      continue;
+    }
+    for (start = i; i < cells; i++) {
+      c = i < len ? _text[i] : ' ';
+      if (!all && drawn[i] == c) break;
+      drawn[i] = c;
+    }
+    gfx.drawChars(_x + start*6*size, _y, (const uint8_t *)drawn + start,
+      i - start, color, bg, size);
+  }
+}
+
+GFX_Value::GFX_Value(int16_t x, int16_t y, uint8_t cells, uint8_t size,
+    uint16_t color, uint16_t bg, boolean left):
+  GFX_Text(x, y, cells, size, color, bg), _value(0), left(left), set(false)
+{
+}
+
+void GFX_Value::setValue(long value) {
+  char buf[GFX_TEXT_MAX+12];
+  int n;
+  if (set && value == _value) return;
+  _value = value;
+  set    = true;
+  if (left) n = snprintf(buf, sizeof(buf), "%ld", value);
+  else      n = snprintf(buf, sizeof(buf), "%*ld", (int)cells, value);
+  // cut to its cells it would read as another number
+  if (n > cells) {
+    memset(buf, '*', cells);
+    buf[cells] = 0;
+  }
+  setText(buf);
+}
+
+GFX_Icon::GFX_Icon(int16_t x, int16_t y, int16_t w, int16_t h,
+    const uint8_t *bitmap, uint16_t color, uint16_t bg):
+  GFX_Widget(x, y, w, h), bitmap(bitmap), color(color), bg(bg)
+{
+}
+
+void GFX_Icon::setBitmap(const uint8_t *bitmap) {
+  if (bitmap == this->bitmap) return;
+  this->bitmap = bitmap;
+  changed = true;
+}
+
+void GFX_Icon::render(Adafruit_GFX &gfx, boolean all) {
+  gfx.fillRect(_x, _y, _w, _h, bg);
+  if (bitmap) gfx.drawBitmap(_x, _y, bitmap, _w, _h, color);
+}
+
+GFX_Screen::GFX_Screen(void): count(0)
+{
+}
+
+boolean GFX_Screen::add(GFX_Widget &widget) {
+  if (count >= GFX_SCREEN_MAX) return false;
+  widgets[count++] = &widget;
+  return true;
+}
+
+uint8_t GFX_Screen::draw(Adafruit_GFX &gfx) {
+  uint8_t i, n = 0;
+  for (i = 0; i < count; i++) {
+    if (widgets[i]->draw(gfx)) n++;
+  }
+  return n;
+}
+
+void GFX_Screen::invalidate(void) {
+  uint8_t i;
+  for (i = 0; i < count; i++) widgets[i]->invalidate();
+}
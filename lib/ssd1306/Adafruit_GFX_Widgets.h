@@ -0,0 +1,132 @@
+#ifndef _ADAFRUIT_GFX_WIDGETS_H
+#define _ADAFRUIT_GFX_WIDGETS_H
+
+#include "Adafruit_GFX.h"
+
+// Retained widgets for screens that are redrawn over and over with mostly
+// the same content.  A widget remembers what it drew last; draw() does
+// nothing until a setter changes it, and a text widget then redraws only
+// the characters that differ.  Everything a widget draws stays inside its
+// bounds (x, y, w, h), it pushes them as the clip rectangle.
+
+#ifndef GFX_TEXT_MAX
+#define GFX_TEXT_MAX 21 // Characters of a text widget, a 128 pixel line
+#endif
+#ifndef GFX_SCREEN_MAX
+#define GFX_SCREEN_MAX 8 // Widgets of a GFX_Screen
+#endif
+
+class GFX_Widget {
+
+ public:
+
+  GFX_Widget(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // Draw what changed since the last draw(), false if nothing did.
+  boolean draw(Adafruit_GFX &gfx);
+  // Draw all of it again next time, e.g. after the display was cleared.
+  void invalidate(void) { valid = false; changed = true; }
+
+  int16_t x(void) { return _x; }
+  int16_t y(void) { return _y; }
+  int16_t width(void) { return _w; }
+  int16_t height(void) { return _h; }
+
+ protected:
+
+  // Draw the changes, or the whole widget when all is set.
+  virtual void render(Adafruit_GFX &gfx, boolean all) = 0;
+
+  int16_t
+    _x, _y, _w, _h;
+  boolean
+    changed, // Something to draw
+    valid;   // The display still shows the last draw()
+};
+
+// A line of text in the 5x7 font, a fixed number of character cells wide.
+// A label is one that is set once.  The text is drawn over its background
+// (color != bg), cells past the end of the text are blank.
+class GFX_Text : public GFX_Widget {
+
+ public:
+
+  GFX_Text(int16_t x, int16_t y, uint8_t cells, uint8_t size = 1,
+    uint16_t color = 1, uint16_t bg = 0);
+
+  void setText(const char *text);
+  void setText(const String &text) { setText(text.c_str()); }
+  void setColor(uint16_t color, uint16_t bg);
+  const char *text(void) { return _text; }
+
+ protected:
+
+  virtual void render(Adafruit_GFX &gfx, boolean all);
+
+  char
+    _text[GFX_TEXT_MAX+1],
+    drawn[GFX_TEXT_MAX]; // The cells on the display
+  uint8_t
+    cells, size;
+  uint16_t
+    color, bg;
+};
+
+// A number, right aligned in its cells unless left is set.  One with more
+// characters than cells shows as a row of '*' instead.
+class GFX_Value : public GFX_Text {
+
+ public:
+
+  GFX_Value(int16_t x, int16_t y, uint8_t cells, uint8_t size = 1,
+    uint16_t color = 1, uint16_t bg = 0, boolean left = false);
+
+  void setValue(long value);
+  long value(void) { return _value; }
+
+ protected:
+
+  long _value;
+  boolean left, set;
+};
+
+// A bitmap as drawBitmap() takes it, on a filled background.  A null
+// bitmap leaves the background only.
+class GFX_Icon : public GFX_Widget {
+
+ public:
+
+  GFX_Icon(int16_t x, int16_t y, int16_t w, int16_t h,
+    const uint8_t *bitmap = 0, uint16_t color = 1, uint16_t bg = 0);
+
+  void setBitmap(const uint8_t *bitmap);
+
+ protected:
+
+  virtual void render(Adafruit_GFX &gfx, boolean all);
+
+  const uint8_t *bitmap;
+  uint16_t
+    color, bg;
+};
+
+// The widgets of one screen, drawn together.
+class GFX_Screen {
+
+ public:
+
+  GFX_Screen(void);
+
+  // False when GFX_SCREEN_MAX widgets are added already.
+  boolean add(GFX_Widget &widget);
+  // Draw the widgets that changed, returns how many did.
+  uint8_t draw(Adafruit_GFX &gfx);
+  void invalidate(void);
+
+ private:
+
+  GFX_Widget *widgets[GFX_SCREEN_MAX];
+  uint8_t count;
+};
+
+#endif // _ADAFRUIT_GFX_WIDGETS_H
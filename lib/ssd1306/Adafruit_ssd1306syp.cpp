@@ -1,202 +1,839 @@
 #include "Adafruit_ssd1306syp.h"
+#ifdef __AVR__
+ #include <avr/pgmspace.h>
+#else
+ #ifndef PROGMEM
+  #define PROGMEM
+ #endif
+ #ifndef pgm_read_byte
+  #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+ #endif
+ #ifndef pgm_read_dword
+  #define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+ #endif
+#endif
+
+//power up sequence, sent as one command transaction after the display off and
+//the geometry dependent commands.
+static const unsigned char initCommands[] PROGMEM = {
+	0x00,//set low column address
+	0x10,//set high column address
+	SSD1306_CMD_MEMORY_MODE,0x00,//horizontal addressing mode, update() streams windows
+	0x40,//set start line address
+	0xB0,//set page start address for page addressing mode
+	0x81,0xCF,//set contrast control register
+	0xA1,//set segment re-map 0 to 127
+	0xA6,//set normal display
+	0xC8,//set COM output scan direction
+	0xD3,0x00,//set display offset, not offset
+	0xD5,0x80,//set display clock divide ratio/oscillator frequency
+	0xD9,0xF1,//set pre-charge period
+	0xDB,0x40,//set vcomh
+	0x8D,0x14,//set DC-DC enable
+	0xAF,
+	SSD1306_CMD_DISPLAY_ON//turn on oled panel
+};
 
-Adafruit_ssd1306syp::Adafruit_ssd1306syp(int sda, int scl):
-Adafruit_GFX(SSD1306_WIDTH,SSD1306_HEIGHT)
+SSD1306_Base::SSD1306_Base(int16_t w, int16_t h, unsigned char* framebuffer, unsigned char bufferPages, int sda, int scl):
+Adafruit_GFX(w,h),
+m_bitbang(sda,scl)
 {
-	m_sda = sda;
-	m_scl = scl;
-	m_pFramebuffer = 0;
+	m_pTransport = &m_bitbang;
+	init(w,h,framebuffer,bufferPages);
 }
-Adafruit_ssd1306syp::~Adafruit_ssd1306syp()
+SSD1306_Base::SSD1306_Base(int16_t w, int16_t h, unsigned char* framebuffer, unsigned char bufferPages, SSD1306_Transport* transport):
+Adafruit_GFX(w,h),
+m_bitbang(-1,-1)
 {
-	//release the memory.
-	if(m_pFramebuffer){
-		free(m_pFramebuffer);
-	}
+	m_pTransport = transport;
+	init(w,h,framebuffer,bufferPages);
+}
+//the state both constructors start from, only the bus differs.
+void SSD1306_Base::init(int16_t w, int16_t h, unsigned char* framebuffer, unsigned char bufferPages)
+{
+	m_pFramebuffer = framebuffer;
+	m_pages = (h+7)/8;
+	m_bandPage = 0;
+	m_bandPages = bufferPages;
+	m_colOffset = (SSD1306_WIDTH-w)/2;
+	m_scrollTop = 0;
+	m_scrollRows = h;
+	m_updateMode = SSD1306_UPDATE_WINDOW;
+	m_flushPage = m_pages;
+	m_flushPending = false;
+	resetStats();
+	invalidate();
+	resetClip();
 }
 //initialized the ssd1306 in the setup function
-bool Adafruit_ssd1306syp::initialize()
+bool SSD1306_Base::initialize()
 {
-	//setup the pin mode
-	pinMode(m_sda,OUTPUT);
-	pinMode(m_scl,OUTPUT);
-
-	//malloc the framebuffer.
-	m_pFramebuffer = (unsigned char*)malloc(SSD1306_FBSIZE);
-	if(m_pFramebuffer == 0){
+	//setup the bus
+	if(!m_pTransport->begin()){
 		return false;
 	}
-	memset(m_pFramebuffer,0,SSD1306_FBSIZE);//clear it.
+
+	memset(m_pFramebuffer,0,WIDTH*m_bandPages);//clear it.
+	invalidate();
 
 	//write command to the screen registers.
-	writeCommand(SSD1306_CMD_DISPLAY_OFF);//display off
-	writeCommand(0x00);//Set Memory Addressing Mode
-	writeCommand(0x10);//00,Horizontal Addressing Mode;01,Vertical Addressing Mode;10,Page Addressing Mode (RESET);11,Invalid
-	writeCommand(0x40);//Set Page Start Address for Page Addressing Mode,0-7
-	writeCommand(0xB0);//Set COM Output Scan Direction
-	writeCommand(0x81);//---set low column address
-	writeCommand(0xCF);//---set high column address
-	writeCommand(0xA1);//--set start line address
-	writeCommand(0xA6);//--set contrast control register
-	writeCommand(0xA8);
-	writeCommand(0x3F);//--set segment re-map 0 to 127
-	writeCommand(0xC8);//--set normal display
-	writeCommand(0xD3);//--set multiplex ratio(1 to 64)
-	writeCommand(0x00);//
-	writeCommand(0xD5);//0xa4,Output follows RAM content;0xa5,Output ignores RAM content
-	writeCommand(0x80);//-set display offset
-	writeCommand(0xD9);//-not offset
-	writeCommand(0xF1);//--set display clock divide ratio/oscillator frequency
-	writeCommand(0xDA);//--set divide ratio
-	writeCommand(0x12);//--set pre-charge period
-	writeCommand(0xDB);//
-	writeCommand(0x40);//--set com pins hardware configuration
-	writeCommand(0x8D);//--set vcomh
-	writeCommand(0x14);//0x20,0.77xVcc
-	writeCommand(0xAF);//--set DC-DC enable
-	writeCommand(SSD1306_CMD_DISPLAY_ON);//--turn on oled panel 
+	const unsigned char geometry[] = {
+		SSD1306_CMD_DISPLAY_OFF,//display off
+		0xA8,(unsigned char)(HEIGHT-1),//set multiplex ratio(1 to 64)
+		0xDA,(unsigned char)(HEIGHT==32 ? 0x02 : 0x12)//set com pins hardware configuration
+	};
+	writeCommandBuffer(geometry,sizeof(geometry));
+	writeCommands(initCommands,sizeof(initCommands));
 
 	delay(10);//wait for the screen loaded.
 	return true;
 }
-void Adafruit_ssd1306syp::clear(bool isUpdateHW)
+void SSD1306_Base::clear(bool isUpdateHW)
 {
-	memset(m_pFramebuffer,0,SSD1306_FBSIZE);//clear the back buffer.
+	unsigned char m;
+	int lo,hi;
+	if(m_pFramebuffer==0) return;
+	//only the columns that were lit need to be sent again.
+	for(m=m_bandPage;m<m_bandPage+m_bandPages;m++)
+	{
+		unsigned char* page = pageRow(m);
+		for(lo=0;lo<WIDTH && page[lo]==0;lo++);
+		for(hi=WIDTH-1;hi>lo && page[hi]==0;hi--);
+		if(lo<WIDTH){
+			markDirty(m,lo,hi);
+		}
+	}
+	memset(m_pFramebuffer,0,WIDTH*m_bandPages);//clear the back buffer.
 	if(isUpdateHW) update();//update the hw immediately
 }
-
-void Adafruit_ssd1306syp::writeCommand(unsigned char cmd)
+void SSD1306_Base::invalidate()
 {
-	startIIC();
-	writeByte(0x78);  //Slave address,SA0=0
-	writeByte(0x00);	//write command
-	writeByte(cmd);
-	stopIIC();
+	unsigned char m;
+	for(m=0;m<m_pages;m++)
+	{
+		m_dirtyLo[m] = 0;
+		m_dirtyHi[m] = WIDTH-1;
+	}
+	m_pageSumValid = 0;
 }
-void Adafruit_ssd1306syp::writeByte(unsigned char b)
+void SSD1306_Base::render(void (*draw)(void* arg), void* arg)
 {
-	unsigned char i;
-	for(i=0;i<8;i++)
+	unsigned char band,end,m,p0;
+	if(m_pFramebuffer==0 || draw==0) return;
+	//the flush reads the framebuffer we are about to reuse.
+	while(isBusy())
+	{
+		poll(0xFFFF);
+	}
+	for(band=0;band<m_pages;band+=m_bandPages)
 	{
-		if((b << i) & 0x80){
-			digitalWrite(m_sda, HIGH);
-		}else{
-			digitalWrite(m_sda, LOW);
+		m_bandPage = band;
+		end = band+m_bandPages < m_pages ? band+m_bandPages : m_pages;
+		memset(m_pFramebuffer,0,WIDTH*m_bandPages);
+		resetClip();
+		draw(arg);
+		//send the runs of pages that changed, one window each.
+		p0 = end;
+		for(m=band;m<=end;m++)
+		{
+			bool changed = false;
+			if(m<end){
+				uint32_t sum = pageSum(m);
+				changed = !(m_pageSumValid & (1<<m)) || m_pageSum[m]!=sum;
+				m_pageSum[m] = sum;
+				if(!changed){
+					m_pageSumValid |= 1<<m;
+					markClean(m);
+				}
+			}
+			if(changed){
+				if(p0==end) p0 = m;
+			}else if(p0<end){
+				sendWindow(p0,m-1,0,WIDTH-1);
+				//sendWindow() forgets the sums, these pages hold the ones just taken.
+				for(;p0<m;p0++) m_pageSumValid |= 1<<p0;
+				p0 = end;
+			}
 		}
-		digitalWrite(m_scl, HIGH);
-		digitalWrite(m_scl, LOW);
-		//    IIC_Byte<<=1;
 	}
-	digitalWrite(m_sda, HIGH);
-	digitalWrite(m_scl, HIGH);
-	
-	digitalWrite(m_scl, LOW);
 }
-void Adafruit_ssd1306syp::startIIC()
+uint32_t SSD1306_Base::pageSum(unsigned char page)
 {
-	digitalWrite(m_scl, HIGH);
-	digitalWrite(m_sda, HIGH);
-	digitalWrite(m_sda, LOW);
-	digitalWrite(m_scl, LOW);
+	//FNV-1a
+	const unsigned char* p = pageRow(page);
+	uint32_t sum = 2166136261u;
+	int16_t n;
+	for(n=0;n<WIDTH;n++)
+	{
+		sum = (sum^p[n])*16777619u;
+	}
+	return sum;
 }
-void Adafruit_ssd1306syp::stopIIC()
+
+void SSD1306_Base::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-	digitalWrite(m_scl, LOW);
-	digitalWrite(m_sda, LOW);
-	digitalWrite(m_scl, HIGH);
-	digitalWrite(m_sda, HIGH);	
-}
+	unsigned char m,p0,p1,mask;
+	if(m_pFramebuffer==0 || w<=0 || h<=0) return;
+	//clip to the clip rectangle, the panel unless pushClip() narrowed it.
+	if(!clipRect(x,y,w,h)) return;
+	int16_t x1 = x+w-1, y1 = y+h-1;
 
-void Adafruit_ssd1306syp::drawPixel(int16_t x, int16_t y, uint16_t color)
+	//partial bytes on the first and last page, whole bytes in between.
+	p0 = y>>3;
+	p1 = y1>>3;
+	for(m=p0;m<=p1;m++)
+	{
+		mask = 0xFF;
+		if(m==p0) mask &= 0xFF<<(y&7);
+		if(m==p1) mask &= 0xFF>>(7-(y1&7));
+		fillPageSpan(m,x,x1,mask,color);
+	}
+}
+void SSD1306_Base::drawSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color)
+{
+	if(m_pFramebuffer==0 || y<clip_y0 || y>clip_y1) return;
+	if(x0<clip_x0) x0 = clip_x0;
+	if(x1>clip_x1) x1 = clip_x1;
+	if(x0>x1) return;
+	fillPageSpan(y>>3,x0,x1,1<<(y&7),color);
+}
+void SSD1306_Base::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+	drawSpan(y,x,x+w-1,color);
+}
+void SSD1306_Base::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+	fillRect(x,y,1,h,color);
+}
+void SSD1306_Base::fillScreen(uint16_t color)
+{
+	fillRect(0,0,WIDTH,HEIGHT,color);
+}
+void SSD1306_Base::resetClip()
+{
+	Adafruit_GFX::resetClip();
+	if(clip_x1>=WIDTH) clip_x1 = WIDTH-1;
+	if(clip_y1>=HEIGHT) clip_y1 = HEIGHT-1;
+	//and to the pages in the framebuffer.
+	if(clip_y0<m_bandPage*8) clip_y0 = m_bandPage*8;
+	if(clip_y1>=(m_bandPage+m_bandPages)*8) clip_y1 = (m_bandPage+m_bandPages)*8-1;
+}
+//a glyph bit as 2 or 4 rows.
+static const unsigned char scale2[16] = {
+	0x00,0x03,0x0C,0x0F,0x30,0x33,0x3C,0x3F,
+	0xC0,0xC3,0xCC,0xCF,0xF0,0xF3,0xFC,0xFF
+};
+static const unsigned char scale4[4] = {0x00,0x0F,0xF0,0xFF};
+//a glyph column scaled to size rows per bit, sizes 2 to 4 fit in 32 bits.
+static uint32_t scaleGlyphColumn(unsigned char line, uint8_t size)
+{
+	uint32_t bits = 0;
+	unsigned char k;
+	switch(size)
+	{
+	case 2:
+		return scale2[line&0x0F] | (scale2[line>>4]<<8);
+	case 4:
+		for(k=0;k<4;k++,line>>=2) bits |= (uint32_t)scale4[line&0x03]<<(k*8);
+		return bits;
+	}
+	for(k=0;k<8;k++,line>>=1)
+	{
+		if(line&1) bits |= 7UL<<(k*3);
+	}
+	return bits;
+}
+//byte n of a glyph column scaled to any size, 0 outside the glyph.
+static unsigned char scaleGlyphByte(unsigned char line, uint8_t size, int16_t n)
+{
+	unsigned char b = 0, r;
+	if(n<0 || n>=size) return 0;
+	if(size==8) return (line>>n)&1 ? 0xFF : 0;
+	//the other sizes don't fall on byte boundaries, a row at a time.
+	for(r=0;r<8;r++)
+	{
+		if((line>>((n*8+r)/size))&1) b |= 1<<r;
+	}
+	return b;
+}
+void SSD1306_Base::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size)
 {
-	unsigned char row;
-	unsigned char offset;
-	unsigned char  preData;//previous data.
-	unsigned char val;
-	int16_t  index;
+	drawChars(x,y,&c,1,color,bg,size);
+}
+void SSD1306_Base::drawChars(int16_t x, int16_t y, const uint8_t* chars, size_t n, uint16_t color, uint16_t bg, uint8_t size)
+{
+	unsigned char cols[6][SSD1306_MAXROW];//the glyph columns as page bytes
+	unsigned char i,m,p0,p1,area,keep,set;
+	int16_t lo[SSD1306_MAXROW], hi[SSD1306_MAXROW];//changed columns of each page
+	int16_t y1 = y+8*size-1;
+	if(m_pFramebuffer==0 || size==0) return;
+	if(y1<clip_y0 || y>clip_y1) return;
+	//rows of the line inside the clip rectangle, the same for every glyph.
+	int16_t top = y<clip_y0 ? clip_y0 : y;
+	int16_t bottom = y1>clip_y1 ? clip_y1 : y1;
+	if(top>bottom) return;//an empty clip rectangle
+	p0 = top>>3;
+	p1 = bottom>>3;
+	for(m=p0;m<=p1;m++)
+	{
+		lo[m] = WIDTH;
+		hi[m] = -1;
+	}
+	memset(cols[5],0,sizeof(cols[5]));//the space between glyphs
 
-	if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()) || ( m_pFramebuffer==0))	return;
+	for(;n>0;n--,chars++,x+=6*size)
+	{
+		//columns of the glyph inside the clip rectangle.
+		int16_t x1 = x+6*size-1;
+		if(x>clip_x1) break;
+		if(x1<clip_x0) continue;
+		int16_t left = x<clip_x0 ? clip_x0 : x;
+		int16_t right = x1>clip_x1 ? clip_x1 : x1;
+		if(left>right) break;//an empty clip rectangle
 
-	//get the previous data;
-	row = y/8;
-	offset =y%8;
-	index = row*width() + x;
-	preData = m_pFramebuffer[index];
+		//the font stores a column per byte, lsb on top, the same as a page byte.
+		//scale it and shift it onto the pages, two scaled bytes make a page byte.
+		const unsigned char* glyph = glcdfont()+*chars*5;
+		for(i=0;i<5;i++)
+		{
+			unsigned char line = pgm_read_byte(glyph+i);
+			if(size==1)
+			{
+				//y+8 keeps the shift off negative numbers, the page before the
+				//panel is -1 then. a glyph starting above the clip rectangle
+				//only has its second page in it.
+				uint16_t bits = (uint16_t)line<<((y+8)&7);
+				if(((y+8)>>3)-1<p0) bits >>= 8;
+				cols[i][0] = bits;
+				if(p1>p0) cols[i][1] = bits>>8;
+				continue;
+			}
+			if(size<=4)
+			{
+				//up to 32 rows, shifted onto the pages they cover.
+				uint64_t bits = (uint64_t)scaleGlyphColumn(line,size)<<((y+8)&7);
+				int16_t page = ((y+8)>>3)-1;
+				for(m=p0;m<=p1;m++)
+				{
+					cols[i][m-p0] = bits>>((m-page)*8);
+				}
+				continue;
+			}
+			//first row of the page in the scaled column plus 8, the first page
+			//starts up to 7 rows above the glyph.
+			int16_t off = p0*8-y+8;
+			unsigned char prev = scaleGlyphByte(line,size,(off>>3)-1), next;
+			for(m=p0;m<=p1;m++,off+=8)
+			{
+				next = scaleGlyphByte(line,size,off>>3);
+				cols[i][m-p0] = (prev|(next<<8))>>(off&7);
+				prev = next;
+			}
+		}
 
-	//set pixel;
-	val = 1<<offset;
-	if(color!=0)
-	{//white! set bit.
-		m_pFramebuffer[index] = preData | val;
-	}else
-	{//black! clear bit.
-		m_pFramebuffer[index] = preData & (~val);
+		//a page at a time, each glyph column repeated size times. with a
+		//background the bytes inside the glyph are written whole.
+		for(m=p0;m<=p1;m++)
+		{
+			unsigned char* row = pageRow(m);
+			int16_t dx, c0, c1;
+			area = 0xFF;
+			if(m==p0) area &= 0xFF<<(top&7);
+			if(m==p1) area &= 0xFF>>(7-(bottom&7));
+			for(i=0,c0=x;i<6;i++,c0+=size)
+			{
+				//the columns of glyph column i inside the clip rectangle.
+				c1 = c0+size-1;
+				if(c1>right) c1 = right;
+				if(c1<left) continue;
+				unsigned char bits = cols[i][m-p0] & area;
+				if(bg!=color)
+				{
+					keep = ~area;
+					set = ((color ? bits : 0) | (bg ? ~bits : 0)) & area;
+				}else
+				{
+					keep = color ? 0xFF : ~bits;
+					set = color ? bits : 0;
+				}
+				for(dx=c0<left ? left : c0;dx<=c1;dx++)
+				{
+					unsigned char val = keep ? (row[dx]&keep)|set : set;
+					if(val!=row[dx])
+					{
+						row[dx] = val;
+						if(lo[m]==WIDTH) lo[m] = dx;
+						hi[m] = dx;
+					}
+				}
+			}
+		}
+	}
+	for(m=p0;m<=p1;m++)
+	{
+		if(hi[m]>=0) markDirty(m,lo[m],hi[m]);
 	}
-
 }
-
-void Adafruit_ssd1306syp::startDataSequence()
+void SSD1306_Base::drawBits(int16_t x, int16_t y, uint8_t bits, uint8_t count, uint16_t color, uint16_t bg)
 {
-	startIIC();
-	writeByte(0x78);
-	writeByte(0x40);	//write data
-	
+	int16_t n,x1 = x+count-1;
+	int16_t lo = WIDTH, hi = -1;
+	if(m_pFramebuffer==0 || y<clip_y0 || y>clip_y1) return;
+	if(x1>clip_x1) x1 = clip_x1;
+	if(x<clip_x0){
+		if(x1<clip_x0) return;
+		bits <<= clip_x0-x;
+		x = clip_x0;
+	}
+	unsigned char* row = pageRow(y>>3);
+	unsigned char mask = 1<<(y&7);
+	for(n=x;n<=x1;n++,bits<<=1)
+	{
+		unsigned char val = ((bits&0x80) ? color : bg) ? (row[n] | mask) : (row[n] & ~mask);
+		if(val != row[n])
+		{
+			row[n] = val;
+			if(n < lo) lo = n;
+			hi = n;
+		}
+	}
+	if(hi >= 0) markDirty(y>>3,lo,hi);
 }
-void Adafruit_ssd1306syp::update()
+//bytes out of flash a 32 bit word at a time. the ESP8266 only reads its flash
+//in words, pgm_read_byte() fetches a whole one for every byte. any address
+//works, the page format fonts start their glyphs on a word. little endian,
+//as the ESP8266 and the AVR are.
+struct FlashReader
 {
-#if 1
-	unsigned int  i=0;
-	unsigned char m,n;
-	for(m=0;m<8;m++)
-	{
-		writeCommand(0xb0+m);	//page0-page1
-		writeCommand(0x00);		//low column start address
-		writeCommand(0x10);		//high column start address
-		
-		startDataSequence();
-		for(n=0;n<128;n++)
+	const uint8_t* p;//the next byte
+	uint32_t word;//the rest of the word p is in, p's byte in bits 0-7
+	unsigned char left;//bytes in word
+	SSD1306_STAT(unsigned long bytes; unsigned long reads;)
+	FlashReader(const uint8_t* at): p(at), left(0)
+	{
+		SSD1306_STAT(bytes = reads = 0);
+	}
+	unsigned char read()
+	{
+		if(!left){
+			uintptr_t a = (uintptr_t)p;
+			word = pgm_read_dword(a&~(uintptr_t)3)>>((a&3)*8);
+			left = 4-(a&3);
+			SSD1306_STAT(reads++);
+		}
+		unsigned char b = word;
+		word >>= 8;
+		left--;
+		p++;
+		SSD1306_STAT(bytes++);
+		return b;
+	}
+	void skip(int16_t n)
+	{
+		p += n;
+		if(n<left){
+			word >>= n*8;
+			left -= n;
+		}else left = 0;
+	}
+};
+//columns from..to of the next page of a w columns wide page format bitmap
+//into out, or just past it without out.
+static void unpackPage(FlashReader& in, int16_t w, int16_t from, int16_t to, unsigned char* out, bool runs)
+{
+	int16_t col,n,i;
+	if(!runs){
+		if(!out){
+			in.skip(w);
+			return;
+		}
+		in.skip(from);
+		for(i=from;i<=to;i++) out[i-from] = in.read();
+		in.skip(w-1-to);
+		return;
+	}
+	//runs of 0x00 or 0xFF bytes, or of bytes to copy, see FontPages.h.
+	for(col=0;col<w;col+=n)
+	{
+		unsigned char code = in.read();
+		n = (code&(code&0x80 ? 0x7F : 0x3F))+1;
+		int16_t c0 = col<from ? from : col;
+		int16_t c1 = col+n-1>to ? to : col+n-1;
+		if(code&0x80){
+			if(out && c0<=c1){
+				in.skip(c0-col);
+				for(i=c0;i<=c1;i++) out[i-from] = in.read();
+				in.skip(col+n-1-c1);
+			}else in.skip(n);
+		}else if(out && c0<=c1){
+			memset(out+c0-from,code&0x40 ? 0xFF : 0x00,c1-c0+1);
+		}
+	}
+}
+void SSD1306_Base::drawPageBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool runs)
+{
+	unsigned char buf[2][SSD1306_WIDTH];//two pages of the bitmap, columns left..right
+	unsigned char m,area,keep,set;
+	int16_t x1 = x+w-1, y1 = y+h-1;
+	if(m_pFramebuffer==0 || w<=0 || h<=0) return;
+	if(y1<clip_y0 || y>clip_y1 || x1<clip_x0 || x>clip_x1) return;
+	int16_t top = y<clip_y0 ? clip_y0 : y;
+	int16_t bottom = y1>clip_y1 ? clip_y1 : y1;
+	int16_t left = x<clip_x0 ? clip_x0 : x;
+	int16_t right = x1>clip_x1 ? clip_x1 : x1;
+	if(top>bottom || left>right) return;//an empty clip rectangle
+	//y+8 keeps the shift off negative numbers, as in drawChars(). bitmap page
+	//n lands on page first+n shifted down, and what it pushes out on the next.
+	unsigned char shift = (y+8)&7;
+	int16_t first = ((y+8)>>3)-1;
+	int16_t pages = (h+7)>>3;
+	int16_t next = 0;//the bitmap page in is at
+	unsigned char* below = buf[0];
+	unsigned char* above = buf[1];
+	FlashReader in(bitmap);
+	for(m=top>>3;m<=(bottom>>3);m++)
+	{
+		unsigned char* row = pageRow(m);
+		int16_t n = m-first, dx, lo = WIDTH, hi = -1;
+		//bitmap page n-1 is the one unpacked last time round, but for the first page.
+		bool hasAbove = shift && n>0 && n-1<pages;
+		bool hasBelow = n<pages;
+		if(hasAbove){
+			if(next==n){
+				unsigned char* t = above;
+				above = below;
+				below = t;
+			}else{
+				for(;next<n-1;next++) unpackPage(in,w,0,0,0,runs);
+				unpackPage(in,w,left-x,right-x,above,runs);
+				next++;
+			}
+		}
+		if(hasBelow){
+			for(;next<n;next++) unpackPage(in,w,0,0,0,runs);
+			unpackPage(in,w,left-x,right-x,below,runs);
+			next++;
+		}
+		area = 0xFF;
+		if(m==(top>>3)) area &= 0xFF<<(top&7);
+		if(m==(bottom>>3)) area &= 0xFF>>(7-(bottom&7));
+		for(dx=left;dx<=right;dx++)
 		{
-			writeByte(m_pFramebuffer[i++]);
+			unsigned char bits = 0;
+			if(hasBelow) bits = below[dx-left]<<shift;
+			if(hasAbove) bits |= above[dx-left]>>(8-shift);
+			bits &= area;
+			if(bg!=color)
+			{
+				keep = ~area;
+				set = ((color ? bits : 0) | (bg ? ~bits : 0)) & area;
+			}else
+			{
+				if(!bits) continue;//nothing to draw in transparent text
+				keep = color ? 0xFF : ~bits;
+				set = color ? bits : 0;
+			}
+			unsigned char val = (row[dx]&keep)|set;
+			if(val!=row[dx])
+			{
+				row[dx] = val;
+				if(lo==WIDTH) lo = dx;
+				hi = dx;
+			}
 		}
-		stopIIC();
+		if(hi>=0) markDirty(m,lo,hi);
 	}
+	SSD1306_STAT(m_stats.glyphBytes += in.bytes; m_stats.glyphReads += in.reads);
+}
+void SSD1306_Base::fillPageSpan(unsigned char page, int16_t x0, int16_t x1, unsigned char mask, uint16_t color)
+{
+	unsigned char* row = pageRow(page);
+	unsigned char set = color ? mask : 0;
+	int16_t n;
+	//the bytes at both ends that already hold the pattern don't need to be sent.
+	while(x0<=x1 && (row[x0]&mask)==set) x0++;
+	while(x1>x0 && (row[x1]&mask)==set) x1--;
+	if(x0>x1) return;
+
+	if(mask==0xFF)
+	{
+		memset(row+x0,set,x1-x0+1);
+	}else
+	{
+		for(n=x0;n<=x1;n++)
+		{
+			row[n] = (row[n]&~mask)|set;
+		}
+	}
+	markDirty(page,x0,x1);
+}
+
+void SSD1306_Base::startscrollright(uint8_t start, uint8_t stop, uint8_t speed)
+{
+	startScroll(SSD1306_CMD_RIGHT_SCROLL,start,stop,0,speed);
+}
+void SSD1306_Base::startscrollleft(uint8_t start, uint8_t stop, uint8_t speed)
+{
+	startScroll(SSD1306_CMD_LEFT_SCROLL,start,stop,0,speed);
+}
+void SSD1306_Base::startscrolldiagright(uint8_t start, uint8_t stop, uint8_t offset, uint8_t speed)
+{
+	startScroll(SSD1306_CMD_VERT_RIGHT_SCROLL,start,stop,offset,speed);
+}
+void SSD1306_Base::startscrolldiagleft(uint8_t start, uint8_t stop, uint8_t offset, uint8_t speed)
+{
+	startScroll(SSD1306_CMD_VERT_LEFT_SCROLL,start,stop,offset,speed);
+}
+void SSD1306_Base::setScrollArea(uint8_t top, uint8_t rows)
+{
+	if(top>=HEIGHT) top = HEIGHT-1;
+	if(rows>HEIGHT-top) rows = HEIGHT-top;
+	m_scrollTop = top;
+	m_scrollRows = rows;
+}
+void SSD1306_Base::startScroll(unsigned char cmd, uint8_t start, uint8_t stop, uint8_t offset, uint8_t speed)
+{
+	//pages past the panel mean "to the bottom".
+	if(stop>=m_pages) stop = m_pages-1;
+	if(start>stop) start = stop;
+	if(offset>=m_scrollRows) offset = m_scrollRows-1;
+	speed &= 7;
+	//a scroll must be stopped before it is set up again.
+	if(cmd==SSD1306_CMD_VERT_RIGHT_SCROLL || cmd==SSD1306_CMD_VERT_LEFT_SCROLL)
+	{
+		const unsigned char seq[] = {
+			SSD1306_CMD_DEACTIVATE_SCROLL,
+			SSD1306_CMD_VERT_SCROLL_AREA,m_scrollTop,m_scrollRows,
+			cmd,0x00,start,speed,stop,offset,
+			SSD1306_CMD_ACTIVATE_SCROLL
+		};
+		writeCommandBuffer(seq,sizeof(seq));
+	}else
+	{
+		const unsigned char seq[] = {
+			SSD1306_CMD_DEACTIVATE_SCROLL,
+			cmd,0x00,start,speed,stop,0x00,0xFF,
+			SSD1306_CMD_ACTIVATE_SCROLL
+		};
+		writeCommandBuffer(seq,sizeof(seq));
+	}
+	//the scroll moves GDDRAM under the sums render() keeps.
+	m_pageSumValid = 0;
+}
+void SSD1306_Base::stopscroll()
+{
+	writeCommand(SSD1306_CMD_DEACTIVATE_SCROLL);
+	invalidate();
+}
+void SSD1306_Base::setStartLine(uint8_t line)
+{
+	writeCommand(SSD1306_CMD_START_LINE | (line&0x3F));
+}
+
+void SSD1306_Base::getStats(SSD1306_Stats& stats)
+{
+#if SSD1306_STATS
+	stats = m_stats;
 #else
-	updateRow(0,SSD1306_MAXROW);
+	memset(&stats,0,sizeof(stats));
 #endif
 }
+void SSD1306_Base::resetStats()
+{
+	SSD1306_STAT(memset(&m_stats,0,sizeof(m_stats)));
+}
 
-void Adafruit_ssd1306syp::updateRow(int rowID)
+void SSD1306_Base::writeCommand(unsigned char cmd)
+{
+	SSD1306_STAT(m_stats.transactions++; m_stats.commandBytes++);
+	m_pTransport->beginTransmission(SSD1306_CONTROL_CMD);
+	m_pTransport->write(cmd);
+	m_pTransport->endTransmission();
+}
+void SSD1306_Base::writeCommands(const uint8_t* seq, size_t n)
+{
+	SSD1306_STAT(m_stats.transactions++; m_stats.commandBytes += n);
+	m_pTransport->beginTransmission(SSD1306_CONTROL_CMD);
+	while(n--)
+	{
+		m_pTransport->write(pgm_read_byte(seq++));
+	}
+	m_pTransport->endTransmission();
+}
+void SSD1306_Base::writeCommandBuffer(const uint8_t* seq, size_t n)
 {
-	unsigned char x;
-	unsigned int  index;
-	if(rowID>=0 && rowID<SSD1306_MAXROW && m_pFramebuffer)
-	{//this part is faster than else.
-		//set the position
-		startIIC();
-		writeByte(0x78);  //Slave address,SA0=0
-		writeByte(0x00);	//write command
+	SSD1306_STAT(m_stats.transactions++; m_stats.commandBytes += n);
+	m_pTransport->beginTransmission(SSD1306_CONTROL_CMD);
+	while(n--)
+	{
+		m_pTransport->write(*seq++);
+	}
+	m_pTransport->endTransmission();
+}
 
-		writeByte(0xb0+rowID);
-		writeByte(((x&0xf0)>>4)|0x10);//|0x10
-		writeByte((x&0x0f)|0x01);//|0x01
+void SSD1306_Base::startDataSequence()
+{
+	SSD1306_STAT(m_stats.transactions++);
+	m_pTransport->beginTransmission(SSD1306_CONTROL_DATA);
+}
+void SSD1306_Base::update()
+{
+	if(m_pFramebuffer==0) return;
+	beginUpdate();
+	while(isBusy())
+	{
+		poll(0xFFFF);
+	}
+}
+void SSD1306_Base::beginUpdate()
+{
+	unsigned char m;
+	unsigned char p0 = m_pages, p1 = 0;
+	unsigned char x0 = 0xFF, x1 = 0;
+	if(m_pFramebuffer==0) return;
+	if(isBusy()){
+		//take the new changes once the running flush is done.
+		m_flushPending = true;
+		return;
+	}
+	//move the dirty spans over to the flush, anything drawn from now on is dirty again.
+	for(m=0;m<m_pages;m++)
+	{
+		if(m<m_bandPage || m>=m_bandPage+m_bandPages){
+			//not in the framebuffer, nothing to send.
+			m_flushLo[m] = 0xFF;
+			m_flushHi[m] = 0;
+			continue;
+		}
+		m_flushLo[m] = m_dirtyLo[m];
+		m_flushHi[m] = m_dirtyHi[m];
+		if(!isDirty(m)) continue;
+		markClean(m);
+		//grow the bounding box of everything dirty.
+		if(p0 == m_pages) p0 = m;
+		p1 = m;
+		if(m_flushLo[m] < x0) x0 = m_flushLo[m];
+		if(m_flushHi[m] > x1) x1 = m_flushHi[m];
+	}
+	if(p0 == m_pages) return;//nothing to send.
 
-		stopIIC();
+	if(m_updateMode == SSD1306_UPDATE_WINDOW){
+		//one window over the bounding box, clean pages inside it are sent too.
+		for(m=p0;m<=p1;m++)
+		{
+			m_flushLo[m] = x0;
+			m_flushHi[m] = x1;
+		}
+	}
+	//the pages going out no longer hold what render() sent last.
+	for(m=p0;m<=p1;m++)
+	{
+		if(m_flushLo[m] <= m_flushHi[m]) m_pageSumValid &= ~(1<<m);
+	}
+	m_flushPage = p0;
+	m_flushLast = p1;
+	m_flushCol = m_flushLo[p0];
+	m_flushNeedWindow = true;
+}
+unsigned int SSD1306_Base::poll(unsigned int maxBytes, unsigned long maxMicros)
+{
+	if(!isBusy()) return 0;
+	unsigned int sent = 0;
+	unsigned long start = (maxMicros || SSD1306_STATS) ? micros() : 0;
+	bool open = false;//data transaction in progress
+	while(isBusy() && sent < maxBytes)
+	{
+		unsigned char m = m_flushPage;
+		if(m_flushCol > m_flushHi[m] || m_flushLo[m] > m_flushHi[m]){
+			//this page is done, go on with the next one that has something to send.
+			for(m++;m<m_pages && m_flushLo[m] > m_flushHi[m];m++);
+			m_flushPage = m;
+			if(m == m_pages) break;
+			m_flushCol = m_flushLo[m];
+			if(m_updateMode == SSD1306_UPDATE_PAGES){
+				m_flushNeedWindow = true;
+			}
+			continue;
+		}
+		if(m_flushNeedWindow){
+			if(open){
+				m_pTransport->endTransmission();
+				open = false;
+			}
+			setWindow(m,m_updateMode == SSD1306_UPDATE_PAGES ? m : m_flushLast,
+				m_flushLo[m],m_flushHi[m]);
+			m_flushNeedWindow = false;
+		}
+		if(!open){
+			startDataSequence();
+			open = true;
+		}
+		m_pTransport->write(pageRow(m)[m_flushCol]);
+		m_flushCol++;
+		sent++;
+		if(maxMicros && micros()-start >= maxMicros) break;
+	}
+	if(open){
+		m_pTransport->endTransmission();
+	}
+	SSD1306_STAT(m_stats.dataBytes += sent; addBusTime(start));
+	SSD1306_STAT(if(!isBusy()) m_stats.frames++);
+	if(!isBusy() && m_flushPending){
+		m_flushPending = false;
+		beginUpdate();
+	}
+	return sent;
+}
+void SSD1306_Base::setWindow(unsigned char p0, unsigned char p1, unsigned char x0, unsigned char x1)
+{
+	//the controller wraps from x1 to x0 of the next page by itself.
+	const unsigned char window[] = {
+		SSD1306_CMD_COLUMN_ADDR,(unsigned char)(x0+m_colOffset),(unsigned char)(x1+m_colOffset),
+		SSD1306_CMD_PAGE_ADDR,p0,p1
+	};
+	writeCommandBuffer(window,sizeof(window));
+}
+void SSD1306_Base::sendWindow(unsigned char p0, unsigned char p1, unsigned char x0, unsigned char x1)
+{
+	unsigned char m,n;
+	SSD1306_STAT(unsigned long start = micros());
+	setWindow(p0,p1,x0,x1);
 
-		//start painting the buffer.
-		startDataSequence();
-		for(x=0;x<SSD1306_WIDTH;x++)
+	//start painting the buffer.
+	startDataSequence();
+	for(m=p0;m<=p1;m++)
+	{
+		unsigned char* page = pageRow(m);
+		for(n=x0;n<=x1;n++)
 		{
-			index = rowID*SSD1306_WIDTH+x;
-	  		writeByte(m_pFramebuffer[index]);
+			m_pTransport->write(page[n]);
 		}
-		stopIIC();
+		markClean(m);
+		m_pageSumValid &= ~(1<<m);
+	}
+	m_pTransport->endTransmission();
+	SSD1306_STAT(m_stats.dataBytes += (p1-p0+1)*(x1-x0+1); m_stats.frames++; addBusTime(start));
+
+	if(isBusy()){
+		//the address pointer moved under a running flush, restart its current page.
+		m_flushCol = m_flushLo[m_flushPage];
+		m_flushNeedWindow = true;
+	}
+}
+
+void SSD1306_Base::updateRow(int rowID)
+{
+	if(rowID>=m_bandPage && rowID<m_bandPage+m_bandPages && m_pFramebuffer)
+	{
+		sendWindow(rowID,rowID,0,WIDTH-1);
 	}
 }
-void Adafruit_ssd1306syp::updateRow(int startID, int endID)
+void SSD1306_Base::updateRow(int startID, int endID)
 {
-	unsigned char y =0;
-	for(y=startID; y<endID; y++)
+	if(startID<m_bandPage) startID = m_bandPage;
+	if(endID>m_bandPage+m_bandPages) endID = m_bandPage+m_bandPages;
+	if(startID<endID && m_pFramebuffer)
 	{
-		updateRow(y);
+		sendWindow(startID,endID-1,0,WIDTH-1);
 	}
 }
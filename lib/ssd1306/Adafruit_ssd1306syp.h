@@ -8,6 +8,9 @@
  #include "WProgram.h"
 #endif
 #include <Adafruit_GFX.h>
+#include <Adafruit_GFX_Raster.h>
+#include "SSD1306_Transport.h"
+#include "SSD1306_BitBang.h"
 
 using namespace std;
 
@@ -18,43 +21,374 @@ using namespace std;
 #define SSD1306_WIDTH 128
 #define SSD1306_HEIGHT 64
 #define SSD1306_FBSIZE 1024 //128x8
-#define SSD1306_MAXROW 8
+#define SSD1306_MAXROW 8//pages of the controller's GDDRAM
 //command macro
   #define SSD1306_CMD_DISPLAY_OFF 0xAE//--turn off the OLED
   #define SSD1306_CMD_DISPLAY_ON 0xAF//--turn on oled panel
+  #define SSD1306_CMD_MEMORY_MODE 0x20//--00 horizontal,01 vertical,10 page addressing
+  #define SSD1306_CMD_COLUMN_ADDR 0x21//--column start,end for horizontal/vertical mode
+  #define SSD1306_CMD_PAGE_ADDR 0x22//--page start,end for horizontal/vertical mode
+  #define SSD1306_CMD_RIGHT_SCROLL 0x26//--continuous horizontal scroll
+  #define SSD1306_CMD_LEFT_SCROLL 0x27
+  #define SSD1306_CMD_VERT_RIGHT_SCROLL 0x29//--continuous vertical and horizontal scroll
+  #define SSD1306_CMD_VERT_LEFT_SCROLL 0x2A
+  #define SSD1306_CMD_DEACTIVATE_SCROLL 0x2E
+  #define SSD1306_CMD_ACTIVATE_SCROLL 0x2F
+  #define SSD1306_CMD_VERT_SCROLL_AREA 0xA3//--rows moved by the vertical scroll
+  #define SSD1306_CMD_START_LINE 0x40//--|line, first GDDRAM row shown at the top
+//scroll step intervals, in frames (a frame is about 10ms with the init settings)
+#define SSD1306_SCROLL_2FRAMES 0x07
+#define SSD1306_SCROLL_3FRAMES 0x04
+#define SSD1306_SCROLL_4FRAMES 0x05
+#define SSD1306_SCROLL_5FRAMES 0x00
+#define SSD1306_SCROLL_25FRAMES 0x06
+#define SSD1306_SCROLL_64FRAMES 0x01
+#define SSD1306_SCROLL_128FRAMES 0x02
+#define SSD1306_SCROLL_256FRAMES 0x03
+//update() transfer modes
+#define SSD1306_UPDATE_WINDOW 0//one data transaction covering every dirty page
+#define SSD1306_UPDATE_PAGES 1//one data transaction per dirty page span
+//default byte budget of one poll(), about 0.8ms at 400kHz
+#define SSD1306_POLL_BYTES 32
 
-class Adafruit_ssd1306syp : public Adafruit_GFX{
+//build with -DSSD1306_STATS=1 to count what goes over the bus, see getStats().
+#ifndef SSD1306_STATS
+ #define SSD1306_STATS 0
+#endif
+#if SSD1306_STATS
+ #define SSD1306_STAT(x) x
+#else
+ #define SSD1306_STAT(x)
+#endif
+
+//bus traffic and glyph reads since the last resetStats().
+struct SSD1306_Stats{
+	unsigned long transactions;
+	unsigned long commandBytes;
+	unsigned long dataBytes;//GDDRAM bytes
+	unsigned long frames;//flushes finished by update()/poll() and updateRow() calls
+	unsigned long busMicros;//time spent sending in update()/poll() and updateRow()
+	unsigned long busMaxMicros;//longest single one of those calls
+	unsigned long glyphBytes;//bitmap bytes drawPageBitmap() used, a pgm_read_byte() each
+	unsigned long glyphReads;//32 bit flash reads it took for them
+};
+
+//everything that doesn't depend on the panel size, see SSD1306_Panel below.
+class SSD1306_Base : public Adafruit_GFX{
 public:
-	Adafruit_ssd1306syp(int sda,int scl);
-	~Adafruit_ssd1306syp();
+	//software IIC on any two pins (SSD1306_BitBang). the framebuffer holds
+	//bufferPages pages, all of the panel's unless it is drawn with render().
+	SSD1306_Base(int16_t w,int16_t h,unsigned char* framebuffer,unsigned char bufferPages,int sda,int scl);
+	//any other bus, e.g. SSD1306_Wire. the transport must outlive the display.
+	SSD1306_Base(int16_t w,int16_t h,unsigned char* framebuffer,unsigned char bufferPages,SSD1306_Transport* transport);
 	//initialized the ssd1306 in the setup function
 	virtual bool initialize();
 
 	//update the framebuffer to the screen.
+	//only the column span of each page that changed since the last update is sent.
 	virtual void update();
-	//totoally 8 rows on this screen in vertical direction.
+	//mark the whole framebuffer changed, the next update() redraws the full screen.
+	void invalidate();
+	//non-blocking update, call beginUpdate() once and poll() from loop() until
+	//isBusy() is false. drawing while busy is safe: whatever changes is dirty
+	//again and goes out with the next update. beginUpdate() while busy queues
+	//another flush behind the running one.
+	void beginUpdate();
+	//send at most maxBytes (and stop after maxMicros if not 0), returns bytes sent.
+	unsigned int poll(unsigned int maxBytes=SSD1306_POLL_BYTES, unsigned long maxMicros=0);
+	bool isBusy(){return m_flushPage < m_pages;}
+	//SSD1306_UPDATE_WINDOW (default) or SSD1306_UPDATE_PAGES.
+	void setUpdateMode(unsigned char mode){m_updateMode = mode;}
+	//totoally height/8 rows on this screen in vertical direction.
 	virtual void updateRow(int rowIndex);
 	virtual void updateRow(int startRow, int endRow);
 
-	//draw one pixel on the screen.
-	virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
-
 	//clear the screen
 	void clear(bool isUpdateHW=false);
+
+	//picture loop: draw(arg) is called once per band of pages the framebuffer
+	//holds, on a cleared buffer with the clip rectangle on the band, and each
+	//band is sent right after. pages that came out the same as last time are
+	//not sent. a panel with a smaller framebuffer than the screen (see
+	//SSD1306_128x64_Paged) can only be drawn this way, update() and clear()
+	//only see the last band there.
+	void render(void (*draw)(void* arg), void* arg=0);
+
+	//fills that work on whole page bytes instead of single pixels.
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	virtual void fillScreen(uint16_t color);
+	//one row of pixels, a masked write of the bit in each byte.
+	virtual void drawSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color);
+	//the 5x7 font a whole page byte per glyph column, or two when y isn't on
+	//a page boundary. larger sizes scale a glyph column into page bytes once
+	//and repeat them size times. text with a background overwrites the bytes.
+	virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+	//a line of glyphs, the clip test and the pages are worked out once.
+	virtual void drawChars(int16_t x, int16_t y, const uint8_t* chars, size_t n, uint16_t color, uint16_t bg, uint8_t size);
+	//count (up to 8) pixels of row y from x on, MSB first: color for a 1 bit,
+	//bg for a 0 bit. the block writes of SSD1306_GFX_AS end up here.
+	void drawBits(int16_t x, int16_t y, uint8_t bits, uint8_t count, uint16_t color, uint16_t bg);
+	//a w x h bitmap in flash in page format: w bytes for rows 0-7, lsb on top,
+	//then w bytes for rows 8-15 and so on, run length coded as the fonts of
+	//FontPages.h with runs set. color for a 1 bit, bg for a 0 bit, or only
+	//the 1 bits when they are the same. written a page byte at a time, read
+	//a 32 bit word at a time, fastest when the bitmap starts on a word.
+	void drawPageBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg, bool runs=false);
+	//the driver doesn't rotate, the clip rectangle stays on the panel whatever
+	//setRotation() made of width() and height().
+	virtual void resetClip();
+
+	//fill hook of Adafruit_GFX_Raster, called without the virtual lookup.
+	void rasterFill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){SSD1306_Base::fillRect(x,y,w,h,color);}
+
+	//hardware scrolling of pages start..stop, the controller moves the picture by
+	//itself so there is no bus traffic until stopscroll(). don't update() while
+	//scrolling, the GDDRAM pointer is undefined then.
+	void startscrollright(uint8_t start, uint8_t stop, uint8_t speed=SSD1306_SCROLL_5FRAMES);
+	void startscrollleft(uint8_t start, uint8_t stop, uint8_t speed=SSD1306_SCROLL_5FRAMES);
+	//horizontal scroll of pages start..stop plus offset rows up per step inside
+	//the vertical scroll area. the controller has no pure vertical scroll, step
+	//setStartLine() for that.
+	void startscrolldiagright(uint8_t start, uint8_t stop, uint8_t offset=1, uint8_t speed=SSD1306_SCROLL_5FRAMES);
+	void startscrolldiagleft(uint8_t start, uint8_t stop, uint8_t offset=1, uint8_t speed=SSD1306_SCROLL_5FRAMES);
+	//rows top..top+rows-1 take part in the vertical scroll, the whole panel by default.
+	void setScrollArea(uint8_t top, uint8_t rows);
+	//stop scrolling. the controller leaves the GDDRAM shifted, so the whole
+	//framebuffer goes out again with the next update().
+	void stopscroll();
+	//show GDDRAM row line at the top of the panel, one command per step.
+	void setStartLine(uint8_t line);
+
+	//copy the counters, all zero unless built with SSD1306_STATS.
+	void getStats(SSD1306_Stats& stats);
+	void resetStats();
+
+	//send a PROGMEM table of n command bytes in one transaction.
+	void writeCommands(const uint8_t* seq, size_t n);
 protected:
-	//write one byte to the screen.
-	void writeByte(unsigned char  b);
 	void writeCommand(unsigned char  cmd);
-
-	//atomic control function
-	void startIIC();//turn on the IIC
-	void stopIIC();//turn off the IIC.
+	//same as writeCommands() for a table in RAM.
+	void writeCommandBuffer(const uint8_t* seq, size_t n);
+	//open a GDDRAM data transaction, close it with m_pTransport->endTransmission().
 	void startDataSequence();
+	//address columns x0..x1 of pages p0..p1.
+	void setWindow(unsigned char p0, unsigned char p1, unsigned char x0, unsigned char x1);
+	//send columns x0..x1 of pages p0..p1 in one data transaction and mark them clean.
+	void sendWindow(unsigned char p0, unsigned char p1, unsigned char x0, unsigned char x1);
+
+	//set (color!=0) or clear the mask bits of columns x0..x1 of a page.
+	void fillPageSpan(unsigned char page, int16_t x0, int16_t x1, unsigned char mask, uint16_t color);
+
+	//the framebuffer row of a page, which must be in the current band.
+	inline unsigned char* pageRow(unsigned char page){return m_pFramebuffer+(page-m_bandPage)*WIDTH;}
+	//checksum of a page of the current band.
+	uint32_t pageSum(unsigned char page);
+
+	//send a continuous scroll setup, cmd is one of the scroll commands above.
+	void startScroll(unsigned char cmd, uint8_t start, uint8_t stop, uint8_t offset, uint8_t speed);
+
+	//grow the dirty span of a page to cover columns x0..x1.
+	inline void markDirty(unsigned char page, unsigned char x0, unsigned char x1){
+		if(x0 < m_dirtyLo[page]) m_dirtyLo[page] = x0;
+		if(x1 > m_dirtyHi[page]) m_dirtyHi[page] = x1;
+	}
+	inline void markClean(unsigned char page){
+		m_dirtyLo[page] = 0xFF;
+		m_dirtyHi[page] = 0;
+	}
+	inline bool isDirty(unsigned char page){return m_dirtyLo[page] <= m_dirtyHi[page];}
 
 	//
 protected:
-	int m_sda;
-	int m_scl;
-	unsigned char* m_pFramebuffer;//the frame buffer for the adafruit gfx. size=64x8 bytes
+	SSD1306_BitBang m_bitbang;//the default bus for the (sda,scl) constructor.
+	SSD1306_Transport* m_pTransport;
+	unsigned char* m_pFramebuffer;//the frame buffer for the adafruit gfx. size=width x m_bandPages bytes
+	unsigned char m_pages;//height/8
+	unsigned char m_bandPage;//first page in the framebuffer, 0 unless render() moved it
+	unsigned char m_bandPages;//pages the framebuffer holds
+	//checksums of the pages render() sent last, bit m of m_pageSumValid is set
+	//while GDDRAM page m still holds it, any other send or a scroll clears it.
+	uint32_t m_pageSum[SSD1306_MAXROW];
+	unsigned char m_pageSumValid;
+	unsigned char m_colOffset;//first GDDRAM column of narrow panels
+	unsigned char m_scrollTop;//vertical scroll area
+	unsigned char m_scrollRows;
+	//changed columns of each page since it was last sent, lo>hi when clean.
+	unsigned char m_dirtyLo[SSD1306_MAXROW];
+	unsigned char m_dirtyHi[SSD1306_MAXROW];
+	unsigned char m_updateMode;
+	//the spans of the running flush and where it is, m_flushPage==m_pages when idle.
+	unsigned char m_flushLo[SSD1306_MAXROW];
+	unsigned char m_flushHi[SSD1306_MAXROW];
+	unsigned char m_flushPage;
+	unsigned char m_flushLast;
+	unsigned char m_flushCol;
+	bool m_flushNeedWindow;
+	bool m_flushPending;
+#if SSD1306_STATS
+	SSD1306_Stats m_stats;
+	//add the time of one bus call that started at start.
+	void addBusTime(unsigned long start){
+		unsigned long us = micros()-start;
+		m_stats.busMicros += us;
+		if(us > m_stats.busMaxMicros) m_stats.busMaxMicros = us;
+	}
+#endif
+private:
+	//the body of both constructors.
+	void init(int16_t w, int16_t h, unsigned char* framebuffer, unsigned char bufferPages);
+};
+
+//a panel of W x H pixels. the framebuffer lives inside the object and all of the
+//geometry is known at compile time, so drawPixel() folds down to a shift and a mask.
+//with PAGES less than the panel's the framebuffer holds a band of that many
+//pages and the panel is drawn with render().
+template <int16_t W, int16_t H, unsigned char PAGES = (H+7)/8>
+class SSD1306_Panel : public SSD1306_Base{
+public:
+	enum{
+		Width = W,
+		Height = H,
+		Pages = PAGES,
+		FramebufferSize = W*PAGES,
+		Banded = PAGES < (H+7)/8
+	};
+	SSD1306_Panel(int sda,int scl):
+	SSD1306_Base(W,H,m_framebuffer,PAGES,sda,scl){}
+	SSD1306_Panel(SSD1306_Transport* transport):
+	SSD1306_Base(W,H,m_framebuffer,PAGES,transport){}
+
+	//draw one pixel on the screen.
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color){
+		rasterPixel(x,y,color);
+	}
+	//the primitives of Adafruit_GFX with drawPixel() inlined into their loops.
+	virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color){
+		Raster::drawLine(*this,x0,y0,x1,y1,color);
+	}
+	virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+		Raster::drawRect(*this,x,y,w,h,color);
+	}
+	virtual void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
+		Raster::drawCircle(*this,x0,y0,r,color);
+	}
+	virtual void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color){
+		Raster::fillCircle(*this,x0,y0,r,color);
+	}
+	virtual void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
+		Raster::drawTriangle(*this,x0,y0,x1,y1,x2,y2,color);
+	}
+	virtual void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color){
+		Raster::fillTriangle(*this,x0,y0,x1,y1,x2,y2,color);
+	}
+	virtual void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color){
+		Raster::drawRoundRect(*this,x,y,w,h,r,color);
+	}
+	virtual void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color){
+		Raster::fillRoundRect(*this,x,y,w,h,r,color);
+	}
+	virtual void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint16_t color){
+		Raster::drawBitmap(*this,x,y,bitmap,w,h,color);
+	}
+
+	//a byte holds 8 rows, columns are the cheap direction to fill.
+	enum { RasterVertical = 1 };
+	//span hooks of Adafruit_GFX_Raster: one masked byte per column of a row,
+	//one byte per page of a column. they clip to the clip rectangle, which
+	//never reaches past the panel, the NoClip ones are for runs known to be
+	//inside it.
+	inline void rasterSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color){
+		if(y < clip_y0 || y > clip_y1) return;
+		if(x0 < clip_x0) x0 = clip_x0;
+		if(x1 > clip_x1) x1 = clip_x1;
+		rasterSpanNoClip(y,x0,x1,color);
+	}
+	inline void rasterSpanNoClip(int16_t y, int16_t x0, int16_t x1, uint16_t color){
+		unsigned char row = y>>3;
+		unsigned char bit = 1<<(y&7);
+		unsigned char* p = bandRow(row);
+		int16_t lo = W, hi = -1;
+		for(int16_t x=x0;x<=x1;x++)
+		{
+			unsigned char val = color ? (p[x] | bit) : (p[x] & ~bit);
+			if(val != p[x])
+			{
+				p[x] = val;
+				if(lo == W) lo = x;
+				hi = x;
+			}
+		}
+		if(hi >= 0) markDirty(row,lo,hi);
+	}
+	inline void rasterHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+		rasterSpan(y,x,x+w-1,color);
+	}
+	inline void rasterVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+		if(x < clip_x0 || x > clip_x1 || h <= 0) return;
+		int16_t y1 = y+h-1;
+		if(y < clip_y0) y = clip_y0;
+		if(y1 > clip_y1) y1 = clip_y1;
+		rasterVLineNoClip(x,y,y1-y+1,color);
+	}
+	inline void rasterVLineNoClip(int16_t x, int16_t y, int16_t h, uint16_t color){
+		if(h <= 0) return;
+		int16_t y1 = y+h-1;
+		unsigned char p0 = y>>3, p1 = y1>>3;
+		for(unsigned char m=p0;m<=p1;m++)
+		{
+			unsigned char mask = 0xFF;
+			if(m==p0) mask &= 0xFF<<(y&7);
+			if(m==p1) mask &= 0xFF>>(7-(y1&7));
+			unsigned char* p = bandRow(m) + x;
+			unsigned char val = color ? (*p | mask) : (*p & ~mask);
+			if(val != *p)
+			{
+				*p = val;
+				markDirty(m,x,x);
+			}
+		}
+	}
+
+	//pixel hooks of Adafruit_GFX_Raster.
+	inline void rasterPixel(int16_t x, int16_t y, uint16_t color){
+		if(x < clip_x0 || x > clip_x1 || y < clip_y0 || y > clip_y1) return;
+		rasterPixelNoClip(x,y,color);
+	}
+	inline void rasterPixelNoClip(int16_t x, int16_t y, uint16_t color){
+		unsigned char row = y>>3;
+		unsigned char* p = bandRow(row) + x;
+		unsigned char val = 1<<(y&7);
+		if(color!=0)
+		{//white! set bit.
+			val = *p | val;
+		}else
+		{//black! clear bit.
+			val = *p & (~val);
+		}
+		if(val != *p)
+		{
+			*p = val;
+			markDirty(row,x,x);
+		}
+	}
+protected:
+	typedef Adafruit_GFX_Raster<SSD1306_Panel> Raster;
+	//pageRow() without the band offset when the whole panel fits.
+	inline unsigned char* bandRow(unsigned char page){
+		return m_framebuffer + (Banded ? page-m_bandPage : page)*W;
+	}
+	unsigned char m_framebuffer[W*PAGES];
+private:
+	//the controller has 8 pages of 128 columns.
+	typedef char geometry_check[(W>0 && W<=128 && H>0 && H<=64 && PAGES>0 && PAGES<=(H+7)/8) ? 1 : -1];
 };
+
+//the panels we carry.
+typedef SSD1306_Panel<128,64> Adafruit_ssd1306syp;
+typedef SSD1306_Panel<128,32> SSD1306_128x32;
+typedef SSD1306_Panel<64,48> SSD1306_64x48;
+//a 128x64 panel with a one page (128 byte) framebuffer, drawn with render().
+typedef SSD1306_Panel<128,64,1> SSD1306_128x64_Paged;
 #endif
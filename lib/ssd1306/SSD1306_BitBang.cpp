@@ -0,0 +1,58 @@
+#include "SSD1306_BitBang.h"
+
+SSD1306_BitBang::SSD1306_BitBang(int sda, int scl, unsigned char address)
+{
+	m_sda = sda;
+	m_scl = scl;
+	m_address = address;
+}
+bool SSD1306_BitBang::begin()
+{
+	//setup the pin mode
+	pinMode(m_sda,OUTPUT);
+	pinMode(m_scl,OUTPUT);
+	return true;
+}
+void SSD1306_BitBang::beginTransmission(unsigned char control)
+{
+	startIIC();
+	write(m_address<<1);  //Slave address,write
+	write(control);
+}
+void SSD1306_BitBang::endTransmission()
+{
+	stopIIC();
+}
+void SSD1306_BitBang::write(unsigned char b)
+{
+	unsigned char i;
+	for(i=0;i<8;i++)
+	{
+		if((b << i) & 0x80){
+			digitalWrite(m_sda, HIGH);
+		}else{
+			digitalWrite(m_sda, LOW);
+		}
+		digitalWrite(m_scl, HIGH);
+		digitalWrite(m_scl, LOW);
+	}
+	//clock the ACK slot, the slave's answer is ignored.
+	digitalWrite(m_sda, HIGH);
+	digitalWrite(m_scl, HIGH);
+
+	digitalWrite(m_scl, LOW);
+}
+void SSD1306_BitBang::startIIC()
+{
+	digitalWrite(m_scl, HIGH);
+	digitalWrite(m_sda, HIGH);
+	digitalWrite(m_sda, LOW);
+	digitalWrite(m_scl, LOW);
+}
+void SSD1306_BitBang::stopIIC()
+{
+	digitalWrite(m_scl, LOW);
+	digitalWrite(m_sda, LOW);
+	digitalWrite(m_scl, HIGH);
+	digitalWrite(m_sda, HIGH);
+}
@@ -0,0 +1,25 @@
+#ifndef _SSD1306_BITBANG_H_
+#define _SSD1306_BITBANG_H_
+
+#include "SSD1306_Transport.h"
+
+//software IIC on any two pins through digitalWrite().
+//the panel's ACK is clocked but never read back.
+class SSD1306_BitBang : public SSD1306_Transport{
+public:
+	SSD1306_BitBang(int sda,int scl,unsigned char address=SSD1306_I2C_ADDRESS);
+
+	virtual bool begin();
+	virtual void beginTransmission(unsigned char control);
+	virtual void write(unsigned char b);
+	virtual void endTransmission();
+protected:
+	//atomic control function
+	void startIIC();//turn on the IIC
+	void stopIIC();//turn off the IIC.
+protected:
+	int m_sda;
+	int m_scl;
+	unsigned char m_address;
+};
+#endif
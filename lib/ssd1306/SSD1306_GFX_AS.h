@@ -0,0 +1,60 @@
+#ifndef _SSD1306_GFX_AS_H_
+#define _SSD1306_GFX_AS_H_
+
+#include "Adafruit_ssd1306syp.h"
+#include <Adafruit_GFX_AS.h>
+
+//the fonts of Adafruit_GFX_AS on an SSD1306 display. it draws into the
+//display's framebuffer, show it with the display's update() as usual.
+//with LOAD_FONT_PAGES text at size 1 is blitted from the page format
+//tables (FontPages.h), else opaque text is written 8 pixels of a glyph row
+//at a time through drawBits(). the fills use the display's page byte
+//versions.
+class SSD1306_GFX_AS : public Adafruit_GFX_AS{
+public:
+	SSD1306_GFX_AS(SSD1306_Base& display):
+	Adafruit_GFX_AS(display.width(),display.height()),m_display(display){}
+
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color){
+		m_display.drawPixel(x,y,color);
+	}
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color){
+		m_display.drawFastVLine(x,y,h,color);
+	}
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color){
+		m_display.drawFastHLine(x,y,w,color);
+	}
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color){
+		m_display.fillRect(x,y,w,h,color);
+	}
+	virtual void drawSpan(int16_t y, int16_t x0, int16_t x1, uint16_t color){
+		m_display.drawSpan(y,x0,x1,color);
+	}
+	//glyphs of fonts 2 to 8 at size 1 go into the framebuffer a page byte at a time.
+	virtual void drawGlyphPages(int16_t x, int16_t y, const uint8_t* glyph, uint8_t w, uint8_t h, uint8_t encoding, uint16_t color, uint16_t bg, uint8_t size){
+		if(size!=1){
+			Adafruit_GFX_AS::drawGlyphPages(x,y,glyph,w,h,encoding,color,bg,size);
+			return;
+		}
+		m_display.drawPageBitmap(x,y,glyph,w,h,color,bg,encoding==FONT_PAGES_RUNS);
+	}
+	//the window the default setAddrWindow() kept, split where a row ends.
+	virtual void pushBits(uint8_t bits, uint8_t count, uint16_t color, uint16_t bg){
+		while(count>0)
+		{
+			uint8_t n = win_x1-win_x+1 < count ? win_x1-win_x+1 : count;
+			m_display.drawBits(win_x,win_y,bits,n,color,bg);
+			bits <<= n;
+			count -= n;
+			win_x += n;
+			if(win_x>win_x1){
+				win_x = win_x0;
+				win_y++;
+			}
+		}
+	}
+protected:
+	SSD1306_Base& m_display;
+};
+
+#endif
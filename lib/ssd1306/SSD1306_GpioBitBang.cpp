@@ -0,0 +1,135 @@
+#include "SSD1306_GpioBitBang.h"
+
+#ifndef ICACHE_RAM_ATTR
+ #define ICACHE_RAM_ATTR
+#endif
+#ifndef F_CPU
+ #define F_CPU 80000000L
+#endif
+
+#if defined(ESP8266)
+ #define SDA_HIGH() GPOS = m_sdaMask
+ #define SDA_LOW() GPOC = m_sdaMask
+ #define SCL_HIGH() GPOS = m_sclMask
+ #define SCL_LOW() GPOC = m_sclMask
+static inline uint32_t ccount()
+{
+	uint32_t c;
+	__asm__ __volatile__("rsr %0,ccount":"=a"(c));
+	return c;
+}
+static inline void wait(unsigned long cycles)
+{
+	uint32_t start = ccount();
+	while(ccount()-start < cycles);
+}
+#else
+ #if defined(__AVR__)
+  #define SDA_HIGH() *m_pSdaOut |= m_sdaMask
+  #define SDA_LOW() *m_pSdaOut &= ~m_sdaMask
+  #define SCL_HIGH() *m_pSclOut |= m_sclMask
+  #define SCL_LOW() *m_pSclOut &= ~m_sclMask
+ #else
+  #define SDA_HIGH() digitalWrite(m_sda, HIGH)
+  #define SDA_LOW() digitalWrite(m_sda, LOW)
+  #define SCL_HIGH() digitalWrite(m_scl, HIGH)
+  #define SCL_LOW() digitalWrite(m_scl, LOW)
+ #endif
+static inline void wait(unsigned long cycles)
+{
+	//a volatile countdown is about 4 cycles per turn.
+	for(volatile unsigned long i=cycles>>2;i;i--);
+}
+#endif
+#define HOLD() if(m_halfCycles) wait(m_halfCycles)
+
+SSD1306_GpioBitBang::SSD1306_GpioBitBang(int sda, int scl, unsigned long clock,
+	unsigned char address):
+SSD1306_BitBang(sda,scl,address)
+{
+	//resolve the pins once.
+#if defined(ESP8266)
+	m_direct = sda>=0 && sda<16 && scl>=0 && scl<16;
+	m_sdaMask = m_direct ? (1UL<<sda) : 0;
+	m_sclMask = m_direct ? (1UL<<scl) : 0;
+	m_pSdaOut = 0;
+	m_pSclOut = 0;
+#elif defined(__AVR__)
+	m_direct = sda>=0 && scl>=0 &&
+		digitalPinToPort(sda)!=NOT_A_PIN && digitalPinToPort(scl)!=NOT_A_PIN;
+	m_sdaMask = m_direct ? digitalPinToBitMask(sda) : 0;
+	m_sclMask = m_direct ? digitalPinToBitMask(scl) : 0;
+	m_pSdaOut = m_direct ? portOutputRegister(digitalPinToPort(sda)) : 0;
+	m_pSclOut = m_direct ? portOutputRegister(digitalPinToPort(scl)) : 0;
+#else
+	m_direct = true;
+	m_sdaMask = 0;
+	m_sclMask = 0;
+	m_pSdaOut = 0;
+	m_pSclOut = 0;
+#endif
+	setClock(clock);
+}
+void SSD1306_GpioBitBang::setClock(unsigned long clock)
+{
+	m_halfCycles = clock ? F_CPU/(2*clock) : 0;
+}
+void ICACHE_RAM_ATTR SSD1306_GpioBitBang::beginTransmission(unsigned char control)
+{
+	if(!m_direct){
+		SSD1306_BitBang::beginTransmission(control);
+		return;
+	}
+	//START: SDA falls while SCL is high.
+	SCL_HIGH();
+	SDA_HIGH();
+	HOLD();
+	SDA_LOW();
+	HOLD();
+	SCL_LOW();
+	HOLD();
+	write(m_address<<1);  //Slave address,write
+	write(control);
+}
+void ICACHE_RAM_ATTR SSD1306_GpioBitBang::write(unsigned char b)
+{
+	if(!m_direct){
+		SSD1306_BitBang::write(b);
+		return;
+	}
+	unsigned char i;
+	for(i=0;i<8;i++)
+	{
+		if(b & 0x80){
+			SDA_HIGH();
+		}else{
+			SDA_LOW();
+		}
+		b <<= 1;
+		SCL_HIGH();
+		HOLD();
+		SCL_LOW();
+		HOLD();
+	}
+	//clock the ACK slot, the slave's answer is ignored.
+	SDA_HIGH();
+	SCL_HIGH();
+	HOLD();
+	SCL_LOW();
+	HOLD();
+}
+void ICACHE_RAM_ATTR SSD1306_GpioBitBang::endTransmission()
+{
+	if(!m_direct){
+		SSD1306_BitBang::endTransmission();
+		return;
+	}
+	//STOP: SDA rises while SCL is high.
+	SCL_LOW();
+	SDA_LOW();
+	HOLD();
+	SCL_HIGH();
+	HOLD();
+	SDA_HIGH();
+	HOLD();
+}
@@ -0,0 +1,46 @@
+#ifndef _SSD1306_GPIOBITBANG_H_
+#define _SSD1306_GPIOBITBANG_H_
+
+#include "SSD1306_BitBang.h"
+
+#if defined(ESP8266)
+ typedef uint32_t ssd1306_pinmask_t;
+ typedef volatile uint32_t ssd1306_pinreg_t;
+#elif defined(__AVR__)
+ typedef uint8_t ssd1306_pinmask_t;
+ typedef volatile uint8_t ssd1306_pinreg_t;
+#else
+ typedef uint32_t ssd1306_pinmask_t;
+ typedef volatile uint32_t ssd1306_pinreg_t;
+#endif
+
+//software IIC that writes the GPIO registers directly.
+//the pin masks are looked up once in the constructor and the byte loop runs
+//from IRAM on the ESP8266. the pins see exactly the same sequence of levels as
+//with SSD1306_BitBang, only each level is held for the configured time
+//(test/host/test_bitbang.cpp compares the two).
+//pins without a set/clear register (GPIO16 on the ESP8266) and cores
+//without a register path fall back to digitalWrite().
+class SSD1306_GpioBitBang : public SSD1306_BitBang{
+public:
+	//clock is the SCL frequency to aim for, 0 toggles the pins as fast as possible.
+	SSD1306_GpioBitBang(int sda,int scl,unsigned long clock=SSD1306_I2C_FAST,
+		unsigned char address=SSD1306_I2C_ADDRESS);
+
+	virtual void beginTransmission(unsigned char control);
+	virtual void write(unsigned char b);
+	virtual void endTransmission();
+
+	//change the bus timing.
+	void setClock(unsigned long clock);
+	//false when the pins are driven through digitalWrite().
+	bool isDirect(){return m_direct;}
+protected:
+	bool m_direct;
+	ssd1306_pinmask_t m_sdaMask;
+	ssd1306_pinmask_t m_sclMask;
+	ssd1306_pinreg_t* m_pSdaOut;
+	ssd1306_pinreg_t* m_pSclOut;
+	unsigned long m_halfCycles;//cpu cycles to hold each half SCL period
+};
+#endif
@@ -0,0 +1,313 @@
+#include "SSD1306_Sim.h"
+
+SSD1306_Sim::SSD1306_Sim(int width, int height, int sda, int scl, unsigned char address)
+{
+	m_width = width;
+	m_height = height;
+	m_sda = sda;
+	m_scl = scl;
+	m_address = address;
+	memset(m_ram,0,sizeof(m_ram));
+	m_sdaLevel = true;
+	m_sclLevel = true;
+	m_inFrame = false;
+	reset();
+	resetCounters();
+}
+void SSD1306_Sim::reset()
+{
+	//the values after RES# from the datasheet.
+	m_mode = 0x02;//page addressing
+	m_colStart = 0;
+	m_colEnd = SSD1306_SIM_COLUMNS-1;
+	m_pageStart = 0;
+	m_pageEnd = SSD1306_SIM_PAGES-1;
+	m_col = 0;
+	m_page = 0;
+	m_startLine = 0;
+	m_offset = 0;
+	m_mux = 63;
+	m_segRemap = false;
+	m_comRemap = false;
+	m_invert = false;
+	m_allOn = false;
+	m_on = false;
+	m_scrolling = false;
+	m_argc = 0;
+	m_argn = 0;
+}
+void SSD1306_Sim::resetCounters()
+{
+	m_edges = 0;
+	m_busBytes = 0;
+	m_transactions = 0;
+	m_commandBytes = 0;
+	m_dataBytes = 0;
+	m_errors = 0;
+}
+bool SSD1306_Sim::begin()
+{
+	return true;
+}
+
+//byte level, the same as what the pin decoder produces.
+void SSD1306_Sim::beginTransmission(unsigned char control)
+{
+	start();
+	receive(m_address<<1);
+	receive(control);
+}
+void SSD1306_Sim::write(unsigned char b)
+{
+	receive(b);
+}
+void SSD1306_Sim::endTransmission()
+{
+	stop();
+}
+
+void SSD1306_Sim::pinWrite(int pin, int level)
+{
+	if(pin == m_sda){
+		setSda(level);
+	}else if(pin == m_scl){
+		setScl(level);
+	}
+}
+void SSD1306_Sim::setSda(bool level)
+{
+	if(level == m_sdaLevel) return;
+	m_edges++;
+	m_sdaLevel = level;
+	//SDA only moves while SCL is high for START and STOP.
+	if(m_sclLevel){
+		if(level){
+			stop();
+		}else{
+			start();
+		}
+	}
+}
+void SSD1306_Sim::setScl(bool level)
+{
+	if(level == m_sclLevel) return;
+	m_edges++;
+	m_sclLevel = level;
+	if(!level || !m_inFrame) return;
+
+	//rising edge, sample SDA.
+	if(m_bit < 8){
+		m_shift = (m_shift<<1) | (m_sdaLevel ? 1 : 0);
+		m_bit++;
+	}else{
+		//the ACK slot, the byte is complete.
+		m_bit = 0;
+		receive(m_shift);
+	}
+}
+
+void SSD1306_Sim::start()
+{
+	//a repeated START ends the transaction before it.
+	if(m_inFrame) stop();
+	m_inFrame = true;
+	m_bit = 0;
+	m_shift = 0;
+	m_first = true;
+	m_selected = false;
+	m_control = true;
+	m_single = false;
+	m_isData = false;
+}
+void SSD1306_Sim::stop()
+{
+	if(!m_inFrame) return;
+	m_inFrame = false;
+	if(m_selected) m_transactions++;
+}
+void SSD1306_Sim::receive(unsigned char b)
+{
+	if(m_first){
+		//slave address, write only.
+		m_first = false;
+		m_selected = b == (m_address<<1);
+		if(!m_selected) m_errors++;
+		else m_busBytes++;
+		return;
+	}
+	if(!m_selected) return;
+	m_busBytes++;
+	if(m_control){
+		m_single = (b & 0x80) != 0;
+		m_isData = (b & 0x40) != 0;
+		m_control = false;
+		return;
+	}
+	if(m_isData){
+		m_dataBytes++;
+		data(b);
+	}else{
+		m_commandBytes++;
+		command(b);
+	}
+	if(m_single) m_control = true;
+}
+
+unsigned char SSD1306_Sim::parameters(unsigned char cmd)
+{
+	switch(cmd)
+	{
+	case 0x26: case 0x27:
+		return 6;
+	case 0x29: case 0x2A:
+		return 5;
+	case 0x21: case 0x22: case 0xA3:
+		return 2;
+	case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+	case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+		return 1;
+	}
+	return 0;
+}
+void SSD1306_Sim::command(unsigned char b)
+{
+	if(m_argn < m_argc){
+		//a parameter of the pending command.
+		m_args[m_argn++] = b;
+		if(m_argn < m_argc) return;
+	}else{
+		m_cmd = b;
+		m_argc = parameters(b);
+		m_argn = 0;
+		if(m_argc) return;
+	}
+	m_argc = 0;
+	m_argn = 0;
+
+	unsigned char cmd = m_cmd;
+	if(cmd < 0x10){
+		//lower column nibble, page addressing.
+		m_colStart = (m_colStart & 0xF0) | cmd;
+		m_col = m_colStart;
+	}else if(cmd < 0x20){
+		m_colStart = (m_colStart & 0x0F) | ((cmd & 0x0F)<<4);
+		m_colStart &= 0x7F;
+		m_col = m_colStart;
+	}else if(cmd >= 0x40 && cmd < 0x80){
+		m_startLine = cmd & 0x3F;
+	}else if(cmd >= 0xB0 && cmd < 0xB8){
+		m_page = cmd & 0x07;
+	}else switch(cmd)
+	{
+	case 0x20:
+		m_mode = m_args[0] & 0x03;
+		if(m_mode == 0x03) m_errors++;
+		break;
+	case 0x21:
+		m_colStart = m_args[0] & 0x7F;
+		m_colEnd = m_args[1] & 0x7F;
+		m_col = m_colStart;
+		break;
+	case 0x22:
+		m_pageStart = m_args[0] & 0x07;
+		m_pageEnd = m_args[1] & 0x07;
+		m_page = m_pageStart;
+		break;
+	case 0x26: case 0x27: case 0x29: case 0x2A:
+	case 0x81: case 0x8D: case 0xA3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+		//no effect on the picture we keep.
+		break;
+	case 0x2E:
+		m_scrolling = false;
+		break;
+	case 0x2F:
+		m_scrolling = true;
+		break;
+	case 0xA0: case 0xA1:
+		m_segRemap = cmd & 1;
+		break;
+	case 0xA4: case 0xA5:
+		m_allOn = cmd & 1;
+		break;
+	case 0xA6: case 0xA7:
+		m_invert = cmd & 1;
+		break;
+	case 0xA8:
+		m_mux = m_args[0] & 0x3F;
+		if(m_mux < 15) m_errors++;
+		break;
+	case 0xAE: case 0xAF:
+		m_on = cmd & 1;
+		break;
+	case 0xC0: case 0xC8:
+		m_comRemap = cmd == 0xC8;
+		break;
+	case 0xD3:
+		m_offset = m_args[0] & 0x3F;
+		break;
+	case 0xE3://nop
+		break;
+	default:
+		m_errors++;
+		break;
+	}
+}
+void SSD1306_Sim::data(unsigned char b)
+{
+	m_ram[m_page][m_col] = b;
+	switch(m_mode)
+	{
+	case 0x00://horizontal, wrap to the next page of the window.
+		if(m_col < m_colEnd){
+			m_col++;
+		}else{
+			m_col = m_colStart;
+			m_page = m_page < m_pageEnd ? m_page+1 : m_pageStart;
+		}
+		break;
+	case 0x01://vertical, wrap to the next column of the window.
+		if(m_page < m_pageEnd){
+			m_page++;
+		}else{
+			m_page = m_pageStart;
+			m_col = m_col < m_colEnd ? m_col+1 : m_colStart;
+		}
+		break;
+	default://page, stay on the page.
+		m_col = m_col < SSD1306_SIM_COLUMNS-1 ? m_col+1 : m_colStart;
+		break;
+	}
+}
+
+bool SSD1306_Sim::pixel(int x, int y)
+{
+	if(x<0 || y<0 || x>=m_width || y>=m_height) return false;
+	if(!m_on) return false;
+	if(m_allOn) return true;
+	if(y > m_mux) return m_invert;
+
+	//the panel is mounted for A1/C8 (what initialize() sends), the other
+	//settings show it mirrored.
+	int col = (SSD1306_SIM_COLUMNS-m_width)/2 + x;
+	if(!m_segRemap) col = SSD1306_SIM_COLUMNS-1-col;
+	int com = m_comRemap ? y : m_mux-y;
+	int row = (com + m_startLine + m_offset) & 0x3F;
+	bool lit = (m_ram[row>>3][col] >> (row&7)) & 1;
+	return lit != m_invert;
+}
+void SSD1306_Sim::printPBM(Print& out)
+{
+	char header[24];
+	int x,y;
+	snprintf(header,sizeof(header),"P1\n%d %d\n",m_width,m_height);
+	out.write((const uint8_t*)header,strlen(header));
+	for(y=0;y<m_height;y++)
+	{
+		for(x=0;x<m_width;x++)
+		{
+			//PBM 1 is black.
+			out.write(pixel(x,y) ? '0' : '1');
+		}
+		out.write('\n');
+	}
+}
@@ -0,0 +1,111 @@
+#ifndef _SSD1306_SIM_H_
+#define _SSD1306_SIM_H_
+
+#include "SSD1306_Transport.h"
+
+//GDDRAM of the controller, 8 pages of 128 columns.
+#define SSD1306_SIM_COLUMNS 128
+#define SSD1306_SIM_PAGES 8
+
+//a simulated SSD1306 for running the display code without a panel.
+//it decodes control bytes, commands and data into its own GDDRAM and follows
+//the addressing modes and column/page windows like the real controller.
+//use it as the transport of the display, or feed it pin levels with pinWrite()
+//(e.g. from a host digitalWrite()) to decode the bit-banged bus itself.
+//test/host runs the driver against it, make -C test/host.
+class SSD1306_Sim : public SSD1306_Transport{
+public:
+	//width/height of the panel behind the controller, sda/scl are only used by pinWrite().
+	SSD1306_Sim(int width=128,int height=64,int sda=-1,int scl=-1,
+		unsigned char address=SSD1306_I2C_ADDRESS);
+
+	//power on reset, GDDRAM keeps its content like on the chip.
+	void reset();
+
+	virtual bool begin();
+	virtual void beginTransmission(unsigned char control);
+	virtual void write(unsigned char b);
+	virtual void endTransmission();
+
+	//pin level input, decodes START/STOP and clocks bits in on rising SCL.
+	void pinWrite(int pin,int level);
+	void setSda(bool level);
+	void setScl(bool level);
+
+	//one GDDRAM byte.
+	unsigned char ram(unsigned char page,unsigned char column){return m_ram[page&7][column&0x7F];}
+	//what the panel shows at x,y after remapping, start line, inversion and display on/off.
+	bool pixel(int x,int y);
+	//the panel as a plain PBM image, lit pixels white.
+	void printPBM(Print& out);
+
+	bool isOn(){return m_on;}
+	bool isScrolling(){return m_scrolling;}
+	unsigned char memoryMode(){return m_mode;}
+
+	//traffic since the last resetCounters().
+	void resetCounters();
+	unsigned long edges(){return m_edges;}//SDA and SCL level changes, pinWrite() only
+	unsigned long busBytes(){return m_busBytes;}//everything ACKed, slave address included
+	unsigned long transactions(){return m_transactions;}
+	unsigned long commandBytes(){return m_commandBytes;}
+	unsigned long dataBytes(){return m_dataBytes;}
+	//bytes that were not understood, a wrong slave address or a bad command.
+	unsigned long errors(){return m_errors;}
+protected:
+	//the bus after bit decoding.
+	void start();
+	void stop();
+	void receive(unsigned char b);
+	void command(unsigned char b);
+	void data(unsigned char b);
+	//parameters that follow the command byte.
+	unsigned char parameters(unsigned char cmd);
+protected:
+	int m_width;
+	int m_height;
+	int m_sda;
+	int m_scl;
+	unsigned char m_address;
+	unsigned char m_ram[SSD1306_SIM_PAGES][SSD1306_SIM_COLUMNS];
+
+	//bus state
+	bool m_sdaLevel;
+	bool m_sclLevel;
+	bool m_inFrame;//between START and STOP
+	unsigned char m_bit;//bits of the current byte so far, 8 is the ACK slot
+	unsigned char m_shift;
+	bool m_first;//the next byte is the slave address
+	bool m_selected;//addressed to us
+	bool m_control;//the next byte is a control byte
+	bool m_single;//Co set, one payload byte then a control byte again
+	bool m_isData;//D/C# of the last control byte
+
+	//command parser
+	unsigned char m_cmd;
+	unsigned char m_args[6];
+	unsigned char m_argc;
+	unsigned char m_argn;
+
+	//registers
+	unsigned char m_mode;
+	unsigned char m_colStart,m_colEnd,m_pageStart,m_pageEnd;
+	unsigned char m_col,m_page;
+	unsigned char m_startLine;
+	unsigned char m_offset;
+	unsigned char m_mux;
+	bool m_segRemap;
+	bool m_comRemap;
+	bool m_invert;
+	bool m_allOn;
+	bool m_on;
+	bool m_scrolling;
+
+	unsigned long m_edges;
+	unsigned long m_busBytes;
+	unsigned long m_transactions;
+	unsigned long m_commandBytes;
+	unsigned long m_dataBytes;
+	unsigned long m_errors;
+};
+#endif
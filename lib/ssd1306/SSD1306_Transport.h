@@ -0,0 +1,35 @@
+#ifndef _SSD1306_TRANSPORT_H_
+#define _SSD1306_TRANSPORT_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+
+//7-bit slave address of the panel (0x78 on the wire with SA0=0)
+#define SSD1306_I2C_ADDRESS 0x3C
+//control bytes sent after the slave address
+#define SSD1306_CONTROL_CMD 0x00
+#define SSD1306_CONTROL_DATA 0x40
+//bus clocks
+#define SSD1306_I2C_STANDARD 100000
+#define SSD1306_I2C_FAST 400000
+#define SSD1306_I2C_FAST_PLUS 1000000
+
+//the bus underneath Adafruit_ssd1306syp.
+//a transaction is START, slave address, one control byte, payload..., STOP.
+class SSD1306_Transport{
+public:
+	virtual ~SSD1306_Transport(){}
+	//setup the pins/peripheral, called from Adafruit_ssd1306syp::initialize().
+	virtual bool begin() = 0;
+
+	//open a transaction, control is SSD1306_CONTROL_CMD or SSD1306_CONTROL_DATA.
+	virtual void beginTransmission(unsigned char control) = 0;
+	//send one payload byte of the open transaction.
+	virtual void write(unsigned char b) = 0;
+	//close the transaction.
+	virtual void endTransmission() = 0;
+};
+#endif
@@ -0,0 +1,59 @@
+#include "SSD1306_Wire.h"
+
+SSD1306_Wire::SSD1306_Wire(int sda, int scl, unsigned long clock,
+	unsigned char address, TwoWire* wire)
+{
+	m_pWire = wire;
+	m_sda = sda;
+	m_scl = scl;
+	m_clock = clock;
+	m_address = address;
+	m_control = SSD1306_CONTROL_CMD;
+	m_count = 0;
+}
+bool SSD1306_Wire::begin()
+{
+#if defined(ESP8266)
+	if(m_sda>=0 && m_scl>=0){
+		m_pWire->begin(m_sda,m_scl);
+	}else{
+		m_pWire->begin();
+	}
+#else
+	m_pWire->begin();
+#endif
+	m_pWire->setClock(m_clock);
+
+	//probe the panel.
+	m_pWire->beginTransmission(m_address);
+	return m_pWire->endTransmission() == 0;
+}
+void SSD1306_Wire::setClock(unsigned long clock)
+{
+	m_clock = clock;
+	m_pWire->setClock(m_clock);
+}
+void SSD1306_Wire::beginTransmission(unsigned char control)
+{
+	m_control = control;
+	m_pWire->beginTransmission(m_address);
+	m_pWire->write(m_control);
+	m_count = 1;
+}
+void SSD1306_Wire::write(unsigned char b)
+{
+	if(m_count >= SSD1306_WIRE_MAX){
+		//the Wire buffer is full, flush it and go on in a new transaction.
+		m_pWire->endTransmission();
+		m_pWire->beginTransmission(m_address);
+		m_pWire->write(m_control);
+		m_count = 1;
+	}
+	m_pWire->write(b);
+	m_count++;
+}
+void SSD1306_Wire::endTransmission()
+{
+	m_pWire->endTransmission();
+	m_count = 0;
+}
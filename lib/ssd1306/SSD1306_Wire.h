@@ -0,0 +1,42 @@
+#ifndef _SSD1306_WIRE_H_
+#define _SSD1306_WIRE_H_
+
+#include "SSD1306_Transport.h"
+#include <Wire.h>
+
+//bytes the Wire library can buffer for one transmission, slave address excluded.
+#if defined(BUFFER_LENGTH)
+ #define SSD1306_WIRE_MAX BUFFER_LENGTH
+#elif defined(I2C_BUFFER_LENGTH)
+ #define SSD1306_WIRE_MAX I2C_BUFFER_LENGTH
+#else
+ #define SSD1306_WIRE_MAX 32
+#endif
+
+//hardware TWI (or the core's optimized twi driver on the ESP8266) through Wire.
+//transactions longer than the Wire buffer are split and the control byte repeated.
+class SSD1306_Wire : public SSD1306_Transport{
+public:
+	//sda/scl are only used on cores that can remap the bus (ESP8266),
+	//pass -1 to keep the core's default pins.
+	SSD1306_Wire(int sda=-1,int scl=-1,unsigned long clock=SSD1306_I2C_FAST,
+		unsigned char address=SSD1306_I2C_ADDRESS,TwoWire* wire=&Wire);
+
+	//returns false when nobody ACKs the slave address.
+	virtual bool begin();
+	virtual void beginTransmission(unsigned char control);
+	virtual void write(unsigned char b);
+	virtual void endTransmission();
+
+	//change the bus clock, takes effect immediately after begin().
+	void setClock(unsigned long clock);
+protected:
+	TwoWire* m_pWire;
+	int m_sda;
+	int m_scl;
+	unsigned long m_clock;
+	unsigned char m_address;
+	unsigned char m_control;//control byte of the open transaction
+	unsigned char m_count;//bytes queued in the Wire buffer
+};
+#endif
@@ -0,0 +1,369 @@
+#include <Adafruit_ssd1306syp.h>
+#include <SSD1306_Wire.h>
+#include <SSD1306_GpioBitBang.h>
+#include <SSD1306_GFX_AS.h>
+#define SDA_PIN 4
+#define SCL_PIN 5
+#define FRAMES 20
+
+//counts what the display sends and throws it away, this is the cost of the
+//display code alone. wrap a real bus with it to count its bytes too.
+class CountingTransport : public SSD1306_Transport{
+public:
+	CountingTransport(SSD1306_Transport* bus=0):m_pBus(bus),bytes(0){}
+	virtual bool begin(){ return m_pBus ? m_pBus->begin() : true; }
+	virtual void beginTransmission(unsigned char control){
+		bytes += 2;//slave address and control byte
+		if(m_pBus) m_pBus->beginTransmission(control);
+	}
+	virtual void write(unsigned char b){
+		bytes++;
+		if(m_pBus) m_pBus->write(b);
+	}
+	virtual void endTransmission(){ if(m_pBus) m_pBus->endTransmission(); }
+	SSD1306_Transport* m_pBus;
+	unsigned long bytes;
+};
+
+SSD1306_BitBang bitbang(SDA_PIN,SCL_PIN);
+SSD1306_GpioBitBang gpio400(SDA_PIN,SCL_PIN,SSD1306_I2C_FAST);
+SSD1306_GpioBitBang gpioMax(SDA_PIN,SCL_PIN,0);
+SSD1306_Wire wire400(SDA_PIN,SCL_PIN,SSD1306_I2C_FAST);
+SSD1306_Wire wire1M(SDA_PIN,SCL_PIN,SSD1306_I2C_FAST_PLUS);
+
+void bench(const char* name, SSD1306_Transport* bus)
+{
+	CountingTransport counter(bus);
+	Adafruit_ssd1306syp display(&counter);
+	if(!display.initialize()){
+		Serial.print(name);
+		Serial.println(": no panel");
+		return;
+	}
+	display.fillRect(0,0,128,64,WHITE);
+
+	counter.bytes = 0;
+	unsigned long start = micros();
+	for(int i=0;i<FRAMES;i++){
+		display.invalidate();
+		display.update();
+	}
+	unsigned long us = micros()-start;
+
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print(us/FRAMES);
+	Serial.print(" us/frame, ");
+	Serial.print(counter.bytes/FRAMES);
+	Serial.print(" bytes/frame, ");
+	Serial.print((unsigned long)(counter.bytes*1000000.0/us));
+	Serial.println(" bytes/s");
+
+	//a status screen where only the seconds tick.
+	display.clear(true);
+	display.setTextColor(WHITE,BLACK);
+	display.setCursor(0,55);
+	display.print("12:34:56");
+	display.update();
+	counter.bytes = 0;
+	start = micros();
+	for(int i=0;i<FRAMES;i++){
+		display.setCursor(6*7,55);
+		display.print(i%10);
+		display.update();
+	}
+	us = micros()-start;
+
+	Serial.print(name);
+	Serial.print(" seconds tick: ");
+	Serial.print(us/FRAMES);
+	Serial.print(" us/frame, ");
+	Serial.print(counter.bytes/FRAMES);
+	Serial.println(" bytes/frame");
+}
+void printFill(const char* name, unsigned long pixels, unsigned long us)
+{
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print(us/FRAMES);
+	Serial.print(" us/frame, ");
+	Serial.print((unsigned long)(pixels*1000000.0/us));
+	Serial.println(" pixels/s");
+}
+//drawing only, against the per pixel path Adafruit_GFX falls back to.
+void benchFill()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start, us;
+	int i,x;
+
+	start = micros();
+	for(i=0;i<FRAMES;i++){
+		for(x=0;x<128;x++){
+			display.Adafruit_GFX::drawLine(x,0,x,63,i&1);
+		}
+	}
+	us = micros()-start;
+	printFill("fill screen generic",128UL*64*FRAMES,us);
+
+	start = micros();
+	for(i=0;i<FRAMES;i++){
+		display.fillScreen(i&1);
+	}
+	us = micros()-start;
+	printFill("fill screen native",128UL*64*FRAMES,us);
+
+	//a rectangle that doesn't start or end on a page boundary.
+	start = micros();
+	for(i=0;i<FRAMES;i++){
+		for(x=10;x<110;x++){
+			display.Adafruit_GFX::drawLine(x,3,x,52,i&1);
+		}
+	}
+	us = micros()-start;
+	printFill("fill rect generic",100UL*50*FRAMES,us);
+
+	start = micros();
+	for(i=0;i<FRAMES;i++){
+		display.fillRect(10,3,100,50,i&1);
+	}
+	us = micros()-start;
+	printFill("fill rect native",100UL*50*FRAMES,us);
+}
+void printRate(const char* name, unsigned long count, unsigned long us)
+{
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print((unsigned long)(count*1000000.0/us));
+	Serial.println("/s");
+}
+//Adafruit_GFX's versions call the virtual drawPixel() per pixel, the panel's
+//own (Adafruit_GFX_Raster) have it inlined.
+void benchRaster()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start;
+	int i;
+
+	start = micros();
+	for(i=0;i<500;i++){
+		display.Adafruit_GFX::fillCircle(64,32,10+i%20,i&1);
+	}
+	printRate("filled circles generic",500,micros()-start);
+	start = micros();
+	for(i=0;i<500;i++){
+		display.fillCircle(64,32,10+i%20,i&1);
+	}
+	printRate("filled circles raster",500,micros()-start);
+
+	start = micros();
+	for(i=0;i<500;i++){
+		display.Adafruit_GFX::drawCircle(64,32,10+i%20,i&1);
+	}
+	printRate("circles generic",500,micros()-start);
+	start = micros();
+	for(i=0;i<500;i++){
+		display.drawCircle(64,32,10+i%20,i&1);
+	}
+	printRate("circles raster",500,micros()-start);
+}
+//characters per second of the 5x7 font at size 1, 2 and 4, per pixel against
+//the page byte writes of the panel. every other line is off the page grid.
+void benchText()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start;
+	int i,size;
+	char name[32];
+
+	for(size=1;size<=4;size*=2){
+		int cols = 21/size, rows = 8/size, n = 2000/size;
+		start = micros();
+		for(i=0;i<n;i++){
+			display.Adafruit_GFX::drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,WHITE,BLACK,size);
+		}
+		sprintf(name,"size %d text generic",size);
+		printRate(name,n,micros()-start);
+		start = micros();
+		for(i=0;i<n;i++){
+			display.drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,WHITE,BLACK,size);
+		}
+		sprintf(name,"size %d text panel",size);
+		printRate(name,n,micros()-start);
+		start = micros();
+		for(i=0;i<n;i++){
+			display.drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,i&2 ? WHITE : BLACK,i&2 ? WHITE : BLACK,size);
+		}
+		sprintf(name,"size %d text transparent",size);
+		printRate(name,n,micros()-start);
+	}
+
+	//a screen of println() lines, the way the sketches draw them.
+	start = micros();
+	for(i=0;i<200;i++){
+		display.setTextSize(1);
+		display.setTextColor(WHITE,BLACK);
+		display.setCursor(0,0);
+		display.println("Feeding Time: 12:30");
+		display.println("Amount: 3");
+		display.println("Delay: 1500");
+		display.println(String("Uptime ")+i);
+	}
+	printRate("println screens",200,micros()-start);
+}
+//fonts of Adafruit_GFX_AS, blitted from their page format tables.
+void benchFonts()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	SSD1306_GFX_AS gfx(display);
+	unsigned long start;
+	int i;
+
+	gfx.setTextColor(WHITE,BLACK);
+	start = micros();
+	for(i=0;i<500;i++){
+		gfx.drawString((char*)"12:34 Temp",0,(i%4)*16,2);
+	}
+	printRate("font 2 strings opaque",500,micros()-start);
+	gfx.setTextColor(WHITE);
+	start = micros();
+	for(i=0;i<500;i++){
+		gfx.drawString((char*)"12:34 Temp",0,(i%4)*16,2);
+	}
+	printRate("font 2 strings transparent",500,micros()-start);
+
+	//flash reads per string, needs -DSSD1306_STATS=1. the glyph bytes took a
+	//pgm_read_byte() each before they were read a 32 bit word at a time.
+	struct { int font; const char* text; } strings[] = {
+		{2,"12:34 Temp"},{4,"12:34"},{7,"1:23"}
+	};
+	SSD1306_Stats stats;
+	gfx.setTextColor(WHITE,BLACK);
+	for(i=0;i<3;i++){
+		display.resetStats();
+		gfx.drawString((char*)strings[i].text,0,0,strings[i].font);
+		display.getStats(stats);
+		Serial.print("font ");
+		Serial.print(strings[i].font);
+		Serial.print(" \"");
+		Serial.print(strings[i].text);
+		Serial.print("\": ");
+		Serial.print(stats.glyphBytes);
+		Serial.print(" glyph bytes, ");
+		Serial.print(stats.glyphReads);
+		Serial.println(" flash reads");
+	}
+}
+//a status screen of a few widgets.
+void drawStatus(Adafruit_GFX& display, int i)
+{
+	display.fillScreen(BLACK);
+	display.drawRoundRect(0,0,128,20,5,WHITE);
+	display.setCursor(6,6);
+	display.print("battery");
+	display.fillRoundRect(60,5,4+i%60,10,3,WHITE);
+	display.drawCircle(100,46,16,WHITE);
+	display.fillTriangle(100,46,100+i%16,32,114,46,WHITE);
+	display.setCursor(0,40);
+	display.print(i);
+}
+//redrawing the whole screen against only the battery widget, and a circle
+//that is mostly off the panel.
+void benchClip()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	display.setTextColor(WHITE);
+	unsigned long start;
+	int i;
+
+	start = micros();
+	for(i=0;i<200;i++){
+		drawStatus(display,i);
+	}
+	printRate("status full redraw",200,micros()-start);
+	start = micros();
+	for(i=0;i<200;i++){
+		display.pushClip(60,5,64,10);
+		drawStatus(display,i);
+		display.popClip();
+	}
+	printRate("status widget redraw",200,micros()-start);
+
+	start = micros();
+	for(i=0;i<500;i++){
+		display.fillCircle(-90,32,100,i&1);
+	}
+	printRate("off panel circles",500,micros()-start);
+}
+//the status screen through render() on the full panel and on one with a one
+//page framebuffer, and the RAM that saves.
+struct StatusFrame{
+	Adafruit_GFX* display;
+	int i;
+};
+void drawStatusFrame(void* arg)
+{
+	StatusFrame* frame = (StatusFrame*)arg;
+	drawStatus(*frame->display,frame->i);
+}
+template <class Panel>
+void benchTile(const char* name)
+{
+	CountingTransport counter;
+	Panel display(&counter);
+	display.initialize();
+	display.setTextColor(WHITE);
+	StatusFrame frame = {&display,0};
+	unsigned long start;
+
+	counter.bytes = 0;
+	start = micros();
+	for(frame.i=0;frame.i<FRAMES;frame.i++){
+		display.render(drawStatusFrame,&frame);
+	}
+	unsigned long us = micros()-start;
+
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print(sizeof(display));
+	Serial.print(" bytes RAM, ");
+	Serial.print(us/FRAMES);
+	Serial.print(" us/frame, ");
+	Serial.print(counter.bytes/FRAMES);
+	Serial.println(" bytes/frame");
+}
+void benchTiles()
+{
+	benchTile<Adafruit_ssd1306syp>("render full framebuffer");
+	benchTile<SSD1306_128x64_Paged>("render one page");
+}
+void setup()
+{
+	Serial.begin(115200);
+	delay(1000);
+	benchFill();
+	benchRaster();
+	benchText();
+	benchFonts();
+	benchClip();
+	benchTiles();
+	bench("mock",0);
+	bench("bitbang",&bitbang);
+	bench("gpio 400kHz",&gpio400);
+	bench("gpio unthrottled",&gpioMax);
+	bench("wire 400kHz",&wire400);
+	bench("wire 1MHz",&wire1M);
+}
+void loop()
+{
+}
@@ -0,0 +1,97 @@
+#include <Adafruit_ssd1306syp.h>
+#include <SSD1306_Sim.h>
+
+//runs the display against the simulated controller, no panel needed.
+//on a host build, forward digitalWrite() to sim.pinWrite() and use
+//Adafruit_ssd1306syp display(SDA,SCL) to decode the real bit-banged bus.
+SSD1306_Sim sim;
+Adafruit_ssd1306syp display(&sim);
+
+//the pin sequence SSD1306_BitBang puts on the bus, fed straight into the
+//simulator so the edges it takes can be counted on the board as well.
+class SimPins : public SSD1306_Transport{
+public:
+	SimPins(SSD1306_Sim* sim):m_pSim(sim){}
+	virtual bool begin(){ return true; }
+	virtual void beginTransmission(unsigned char control){
+		m_pSim->setScl(HIGH);
+		m_pSim->setSda(HIGH);
+		m_pSim->setSda(LOW);
+		m_pSim->setScl(LOW);
+		write(SSD1306_I2C_ADDRESS<<1);
+		write(control);
+	}
+	virtual void write(unsigned char b){
+		for(unsigned char i=0;i<8;i++){
+			m_pSim->setSda((b<<i) & 0x80);
+			m_pSim->setScl(HIGH);
+			m_pSim->setScl(LOW);
+		}
+		m_pSim->setSda(HIGH);
+		m_pSim->setScl(HIGH);
+		m_pSim->setScl(LOW);
+	}
+	virtual void endTransmission(){
+		m_pSim->setScl(LOW);
+		m_pSim->setSda(LOW);
+		m_pSim->setScl(HIGH);
+		m_pSim->setSda(HIGH);
+	}
+	SSD1306_Sim* m_pSim;
+};
+SSD1306_Sim pinSim;
+SimPins pins(&pinSim);
+Adafruit_ssd1306syp pinDisplay(&pins);
+
+void drawStatus(Adafruit_ssd1306syp& d, int seconds)
+{
+	d.setTextColor(WHITE,BLACK);
+	d.setCursor(0,0);
+	d.print("SSD1306 sim");
+	d.setCursor(0,55);
+	d.print("12:34:");
+	if(seconds<10) d.print('0');
+	d.print(seconds);
+}
+void report(const char* name, SSD1306_Sim& s)
+{
+	Serial.print(name);
+	Serial.print(": ");
+	Serial.print(s.edges());
+	Serial.print(" edges, ");
+	Serial.print(s.busBytes());
+	Serial.print(" bytes, ");
+	Serial.print(s.transactions());
+	Serial.print(" transactions, ");
+	Serial.print(s.commandBytes());
+	Serial.print(" cmd/");
+	Serial.print(s.dataBytes());
+	Serial.print(" data, ");
+	Serial.print(s.errors());
+	Serial.println(" errors");
+}
+void setup()
+{
+	Serial.begin(115200);
+	delay(1000);
+	display.initialize();
+	drawStatus(display,56);
+	display.update();
+	sim.printPBM(Serial);
+	report("init + first screen",sim);
+
+	pinDisplay.initialize();
+	drawStatus(pinDisplay,56);
+	pinDisplay.update();
+	pinSim.resetCounters();
+	pinDisplay.invalidate();
+	pinDisplay.update();
+	report("full screen",pinSim);
+	pinSim.resetCounters();
+	drawStatus(pinDisplay,57);
+	pinDisplay.update();
+	report("seconds tick",pinSim);
+}
+void loop()
+{
+}
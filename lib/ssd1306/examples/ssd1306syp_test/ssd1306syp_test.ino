@@ -17,6 +17,7 @@ void loop()
   display.setTextColor(WHITE);
   display.setCursor(0,0);
   display.println("Hello, world!");
+  display.update();
   display.startscrollright(0x00, 0x0F);
   delay(2000);
   display.stopscroll();
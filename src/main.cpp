@@ -3,6 +3,8 @@
 #include <ESP8266WiFi.h>
 #include <ESP8266WebServer.h>
 #include <Adafruit_ssd1306syp.h>
+#include <Adafruit_GFX_Widgets.h>
+#include <SSD1306_Wire.h>
 #include <EEPROM.h>
 #include <ArduinoOTA.h>
 #include "config.h"
@@ -42,7 +44,15 @@ bool requestDisplayUpdate = true;
 
 ESP8266WebServer server(80);
 
-Adafruit_ssd1306syp display(SDA_PIN,SCL_PIN);
+SSD1306_Wire displayBus(SDA_PIN,SCL_PIN,SSD1306_I2C_FAST);
+Adafruit_ssd1306syp display(&displayBus);
+
+// the status screen, each line only redrawn when its text changes
+GFX_Text feedingTimeText(0,0,21);
+GFX_Text amountText(0,15,21);
+GFX_Text ipText(0,40,21);
+GFX_Text clockText(0,55,21);
+GFX_Screen statusScreen;
 
 void HandleClient();
 void ShowClientResponse();
@@ -55,6 +65,10 @@ void setup(){
   Serial.begin(115200);
   delay(1000);
   display.initialize();
+  statusScreen.add(feedingTimeText);
+  statusScreen.add(amountText);
+  statusScreen.add(ipText);
+  statusScreen.add(clockText);
   WiFi.begin(ssid, pass);
   while(WiFi.status() != WL_CONNECTED) {
     delay(500);
@@ -117,6 +131,8 @@ void setup(){
 
   ArduinoOTA.onStart([]() {
     String type;
+    // the OTA screens draw over the status screen
+    statusScreen.invalidate();
     if (ArduinoOTA.getCommand() == U_FLASH)
       type = "sketch";
     else // U_SPIFFS
@@ -352,6 +368,9 @@ void blink(){
       display.update();
       delay(2000);
   }
+  // hand a blank screen back to updateDisplay()
+  display.clear();
+  statusScreen.invalidate();
 }
 
 String getUTCTime() {
@@ -386,18 +405,14 @@ String getUTCTime() {
 }
 
 void updateDisplay(String timeString) {
-  display.clear();
-  display.setCursor(0,0);
-  display.setTextSize(1);
-  display.setTextColor(WHITE);
-  display.println("Feeding Time: " + String(rawClientTime));
-  display.setCursor(0,15);
-  display.println("Amount: " + String(rawClientAmount) + ((String(rawClientAmount).toInt() > 1) ? " q-cups" : " q-cup"));
-  display.setCursor(0,40);
-  display.println(WiFi.localIP());
-  display.setCursor(0,55);
-  display.println(timeString);
-  display.update();
+  feedingTimeText.setText("Feeding Time: " + String(rawClientTime));
+  amountText.setText("Amount: " + String(rawClientAmount) + ((String(rawClientAmount).toInt() > 1) ? " q-cups" : " q-cup"));
+  ipText.setText(WiFi.localIP().toString());
+  clockText.setText(timeString);
+  // only the lines that changed are drawn, sent a few bytes at a time from loop()
+  if(statusScreen.draw(display)) {
+    display.beginUpdate();
+  }
 }
 
 String convertUTCtoLocal(String nistTime) {
@@ -471,6 +486,7 @@ bool isFeedingTime(String localTime) {
 void loop(){
   ArduinoOTA.handle();
   server.handleClient();
+  display.poll();
   unsigned long currentLoopTime = millis();
   if(currentLoopTime - previousLoopTime >= loopDelay || previousLoopTime == 0 || requestDisplayUpdate) {
     if(requestDisplayUpdate) {
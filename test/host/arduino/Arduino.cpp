@@ -0,0 +1,34 @@
+#include "Arduino.h"
+#include <time.h>
+
+void (*hostPinWrite)(uint8_t pin, uint8_t level) = 0;
+unsigned long hostMicrosCalls = 0;
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+	if(hostPinWrite) hostPinWrite(pin,level);
+}
+int digitalRead(uint8_t pin)
+{
+	return LOW;
+}
+void delay(unsigned long ms)
+{
+}
+void delayMicroseconds(unsigned int us)
+{
+}
+unsigned long micros()
+{
+	struct timespec t;
+	hostMicrosCalls++;
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return t.tv_sec*1000000UL+t.tv_nsec/1000;
+}
+unsigned long millis()
+{
+	return micros()/1000;
+}
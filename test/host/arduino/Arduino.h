@@ -0,0 +1,51 @@
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+//just enough of the Arduino core to build lib/ssd1306 on the host.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long micros();
+unsigned long millis();
+
+//the tests watch the pins through this, null drops the writes.
+extern void (*hostPinWrite)(uint8_t pin, uint8_t level);
+//calls of micros() so far.
+extern unsigned long hostMicrosCalls;
+
+#include "Print.h"
+
+class String{
+public:
+	String(const char* s=""){ strncpy(m_buf,s,sizeof(m_buf)-1); m_buf[sizeof(m_buf)-1] = 0; }
+	const char* c_str() const { return m_buf; }
+	unsigned int length() const { return strlen(m_buf); }
+private:
+	char m_buf[64];
+};
+
+#endif
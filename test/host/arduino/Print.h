@@ -0,0 +1,27 @@
+#ifndef _HOST_PRINT_H_
+#define _HOST_PRINT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+class Print{
+public:
+	virtual ~Print(){}
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size){
+		size_t n = 0;
+		while(size--) n += write(*buffer++);
+		return n;
+	}
+	size_t write(const char* s){ return write((const uint8_t*)s,strlen(s)); }
+	size_t print(const char* s){ return write(s); }
+	size_t print(char c){ return write((uint8_t)c); }
+	size_t print(long v){ char b[16]; snprintf(b,sizeof(b),"%ld",v); return write(b); }
+	size_t print(int v){ return print((long)v); }
+	size_t println(const char* s){ return print(s)+println(); }
+	size_t println(){ return write("\r\n"); }
+};
+
+#endif
@@ -0,0 +1,312 @@
+//the ssd1306syp_bench example on the host: the bytes and transactions per
+//frame, pixels, shapes and characters per second of the drawing code and
+//the flash reads of the Adafruit_GFX_AS fonts.
+//the times are of this machine, the counts are those of the board.
+//   make -C test/host bench
+#include "host_test.h"
+#include <SSD1306_GFX_AS.h>
+
+//the loops of the example, run a hundred times longer so the host takes
+//long enough to time.
+#define FRAMES 2000
+#define SHAPES 50000
+#define SCREENS 20000
+#define CHARS 200000
+
+//counts what the display sends and throws it away, like the mock bus of the
+//example, and the transactions as well.
+class CountingTransport : public SSD1306_Transport{
+public:
+	CountingTransport():bytes(0),transactions(0){}
+	virtual bool begin(){return true;}
+	virtual void beginTransmission(unsigned char control){
+		bytes += 2;//slave address and control byte
+		transactions++;
+	}
+	virtual void write(unsigned char b){bytes++;}
+	virtual void endTransmission(){}
+	void clear(){bytes = transactions = 0;}
+	unsigned long bytes;
+	unsigned long transactions;
+};
+
+static void printFrames(const char* name, CountingTransport& counter, unsigned long us)
+{
+	printf("%s: %.2f us/frame, %lu bytes/frame, %lu transactions/frame\n",
+		name,(double)us/FRAMES,counter.bytes/FRAMES,counter.transactions/FRAMES);
+}
+static void printFill(const char* name, unsigned long pixels, unsigned long us)
+{
+	printf("%s: %lu pixels/frame, %.2f us/frame, %lu pixels/s\n",
+		name,pixels/FRAMES,(double)us/FRAMES,(unsigned long)(pixels*1000000.0/(us ? us : 1)));
+}
+static void printRate(const char* name, unsigned long count, unsigned long us)
+{
+	printf("%s: %lu/s\n",name,(unsigned long)(count*1000000.0/(us ? us : 1)));
+}
+
+//a full frame, and a status screen where only the seconds tick.
+static void benchBus()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	display.fillRect(0,0,128,64,WHITE);
+
+	counter.clear();
+	unsigned long start = micros();
+	for(int i=0;i<FRAMES;i++)
+	{
+		display.invalidate();
+		display.update();
+	}
+	printFrames("full frame",counter,micros()-start);
+
+	display.clear(true);
+	display.setTextColor(WHITE,BLACK);
+	display.setCursor(0,55);
+	display.print("12:34:56");
+	display.update();
+	counter.clear();
+	display.resetStats();
+	start = micros();
+	for(int i=0;i<FRAMES;i++)
+	{
+		display.setCursor(6*7,55);
+		display.print(i%10);
+		display.update();
+	}
+	printFrames("seconds tick",counter,micros()-start);
+	SSD1306_Stats stats;
+	display.getStats(stats);
+	printf("seconds tick: %lu GDDRAM bytes/frame\n",stats.dataBytes/FRAMES);
+}
+
+//drawing only, against the per pixel path Adafruit_GFX falls back to.
+static void benchFill()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start;
+	int i,x;
+
+	start = micros();
+	for(i=0;i<FRAMES;i++)
+	{
+		for(x=0;x<128;x++) display.Adafruit_GFX::drawLine(x,0,x,63,i&1);
+	}
+	printFill("fill screen generic",128UL*64*FRAMES,micros()-start);
+	start = micros();
+	for(i=0;i<FRAMES;i++) display.fillScreen(i&1);
+	printFill("fill screen native",128UL*64*FRAMES,micros()-start);
+
+	//a rectangle that doesn't start or end on a page boundary.
+	start = micros();
+	for(i=0;i<FRAMES;i++)
+	{
+		for(x=10;x<110;x++) display.Adafruit_GFX::drawLine(x,3,x,52,i&1);
+	}
+	printFill("fill rect generic",100UL*50*FRAMES,micros()-start);
+	start = micros();
+	for(i=0;i<FRAMES;i++) display.fillRect(10,3,100,50,i&1);
+	printFill("fill rect native",100UL*50*FRAMES,micros()-start);
+}
+
+//Adafruit_GFX's versions call the virtual drawPixel() per pixel, the panel's
+//own (Adafruit_GFX_Raster) have it inlined.
+static void benchRaster()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start;
+	int i;
+
+	start = micros();
+	for(i=0;i<SHAPES;i++) display.Adafruit_GFX::fillCircle(64,32,10+i%20,i&1);
+	printRate("filled circles generic",SHAPES,micros()-start);
+	start = micros();
+	for(i=0;i<SHAPES;i++) display.fillCircle(64,32,10+i%20,i&1);
+	printRate("filled circles raster",SHAPES,micros()-start);
+
+	start = micros();
+	for(i=0;i<SHAPES;i++) display.Adafruit_GFX::drawCircle(64,32,10+i%20,i&1);
+	printRate("circles generic",SHAPES,micros()-start);
+	start = micros();
+	for(i=0;i<SHAPES;i++) display.drawCircle(64,32,10+i%20,i&1);
+	printRate("circles raster",SHAPES,micros()-start);
+}
+
+//characters per second of the 5x7 font at size 1, 2 and 4, per pixel against
+//the page byte writes of the panel. every other line is off the page grid.
+static void benchText()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	unsigned long start;
+	int i,size;
+	char name[32];
+
+	for(size=1;size<=4;size*=2)
+	{
+		int cols = 21/size, rows = 8/size, n = CHARS/size;
+		start = micros();
+		for(i=0;i<n;i++)
+		{
+			display.Adafruit_GFX::drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,WHITE,BLACK,size);
+		}
+		sprintf(name,"size %d text generic",size);
+		printRate(name,n,micros()-start);
+		start = micros();
+		for(i=0;i<n;i++)
+		{
+			display.drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,WHITE,BLACK,size);
+		}
+		sprintf(name,"size %d text panel",size);
+		printRate(name,n,micros()-start);
+		start = micros();
+		for(i=0;i<n;i++)
+		{
+			display.drawChar((i%cols)*6*size,(i%rows)*8*size+(i&1)*3,'A'+i%26,i&2 ? WHITE : BLACK,i&2 ? WHITE : BLACK,size);
+		}
+		sprintf(name,"size %d text transparent",size);
+		printRate(name,n,micros()-start);
+	}
+
+	//a screen of println() lines, the way the sketches draw them.
+	start = micros();
+	for(i=0;i<SCREENS;i++)
+	{
+		display.setTextSize(1);
+		display.setTextColor(WHITE,BLACK);
+		display.setCursor(0,0);
+		display.println("Feeding Time: 12:30");
+		display.println("Amount: 3");
+		display.println("Delay: 1500");
+		display.print("Uptime ");
+		display.print(i);
+		display.println();
+	}
+	printRate("println screens",SCREENS,micros()-start);
+}
+
+//fonts of Adafruit_GFX_AS, blitted from their page format tables.
+static void benchFonts()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	SSD1306_GFX_AS gfx(display);
+	unsigned long start;
+	int i;
+
+	gfx.setTextColor(WHITE,BLACK);
+	start = micros();
+	for(i=0;i<SHAPES;i++) gfx.drawString((char*)"12:34 Temp",0,(i%4)*16,2);
+	printRate("font 2 strings opaque",SHAPES,micros()-start);
+	gfx.setTextColor(WHITE);
+	start = micros();
+	for(i=0;i<SHAPES;i++) gfx.drawString((char*)"12:34 Temp",0,(i%4)*16,2);
+	printRate("font 2 strings transparent",SHAPES,micros()-start);
+
+	//flash reads per string. the glyph bytes took a pgm_read_byte() each
+	//before they were read a 32 bit word at a time.
+	struct { int font; const char* text; } strings[] = {
+		{2,"12:34 Temp"},{4,"12:34"},{7,"1:23"}
+	};
+	SSD1306_Stats stats;
+	gfx.setTextColor(WHITE,BLACK);
+	for(i=0;i<3;i++)
+	{
+		display.resetStats();
+		gfx.drawString((char*)strings[i].text,0,0,strings[i].font);
+		display.getStats(stats);
+		printf("font %d \"%s\": %lu glyph bytes, %lu flash reads\n",
+			strings[i].font,strings[i].text,stats.glyphBytes,stats.glyphReads);
+	}
+}
+
+//a status screen of a few widgets.
+static void drawStatus(Adafruit_GFX& display, int i)
+{
+	display.fillScreen(BLACK);
+	display.drawRoundRect(0,0,128,20,5,WHITE);
+	display.setCursor(6,6);
+	display.print("battery");
+	display.fillRoundRect(60,5,4+i%60,10,3,WHITE);
+	display.drawCircle(100,46,16,WHITE);
+	display.fillTriangle(100,46,100+i%16,32,114,46,WHITE);
+	display.setCursor(0,40);
+	display.print(i);
+}
+
+//redrawing the whole screen against only the battery widget, and a circle
+//that is mostly off the panel.
+static void benchClip()
+{
+	CountingTransport counter;
+	Adafruit_ssd1306syp display(&counter);
+	display.initialize();
+	display.setTextColor(WHITE);
+	unsigned long start;
+	int i;
+
+	start = micros();
+	for(i=0;i<SCREENS;i++) drawStatus(display,i);
+	printRate("status full redraw",SCREENS,micros()-start);
+	start = micros();
+	for(i=0;i<SCREENS;i++)
+	{
+		display.pushClip(60,5,64,10);
+		drawStatus(display,i);
+		display.popClip();
+	}
+	printRate("status widget redraw",SCREENS,micros()-start);
+
+	start = micros();
+	for(i=0;i<SHAPES;i++) display.fillCircle(-90,32,100,i&1);
+	printRate("off panel circles",SHAPES,micros()-start);
+}
+
+//the status screen through render() on the full panel and on one with a one
+//page framebuffer, and the RAM that saves.
+struct StatusFrame{
+	Adafruit_GFX* display;
+	int i;
+};
+static void drawStatusFrame(void* arg)
+{
+	StatusFrame* frame = (StatusFrame*)arg;
+	drawStatus(*frame->display,frame->i);
+}
+template <class Panel>
+static void benchTile(const char* name)
+{
+	CountingTransport counter;
+	Panel display(&counter);
+	display.initialize();
+	display.setTextColor(WHITE);
+	StatusFrame frame = {&display,0};
+
+	counter.clear();
+	unsigned long start = micros();
+	for(frame.i=0;frame.i<FRAMES;frame.i++) display.render(drawStatusFrame,&frame);
+	unsigned long us = micros()-start;
+	printf("%s: %lu bytes RAM, %.2f us/frame, %lu bytes/frame, %lu transactions/frame\n",
+		name,(unsigned long)sizeof(display),(double)us/FRAMES,counter.bytes/FRAMES,counter.transactions/FRAMES);
+}
+
+int main()
+{
+	benchBus();
+	benchFill();
+	benchRaster();
+	benchText();
+	benchFonts();
+	benchClip();
+	benchTile<Adafruit_ssd1306syp>("render full framebuffer");
+	benchTile<SSD1306_128x64_Paged>("render one page");
+	return 0;
+}
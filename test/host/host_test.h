@@ -0,0 +1,121 @@
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+//helpers of the host tests: a failure count, a view into the framebuffer of
+//a panel and a random drawing.
+#include <Adafruit_ssd1306syp.h>
+#include <SSD1306_Sim.h>
+
+static int failures = 0;
+
+#define CHECK(cond) check((cond),#cond,__FILE__,__LINE__)
+#define RUN(call) do{ fprintf(stderr,"%s\n",#call); call; }while(0)
+
+static inline void check(bool ok, const char* what, const char* file, int line)
+{
+	if(ok) return;
+	failures++;
+	fprintf(stderr,"%s:%d: failed: %s\n",file,line,what);
+}
+static inline int finish()
+{
+	if(failures) fprintf(stderr,"%d failed\n",failures);
+	return failures ? 1 : 0;
+}
+
+//a panel that shows its framebuffer, for comparing it with the simulator.
+template <class Panel>
+class Probe : public Panel{
+public:
+	Probe(SSD1306_Transport* transport):Panel(transport){}
+	//a byte of the framebuffer, page must be in the current band.
+	unsigned char fb(unsigned char page, int16_t x){return this->pageRow(page)[x];}
+	unsigned char colOffset(){return this->m_colOffset;}
+	unsigned char pages(){return this->m_pages;}
+	//the dirty span of a page, lo>hi when clean.
+	unsigned char dirtyLo(unsigned char page){return this->m_dirtyLo[page];}
+	unsigned char dirtyHi(unsigned char page){return this->m_dirtyHi[page];}
+	void markAllClean(){for(unsigned char m=0;m<this->m_pages;m++) this->markClean(m);}
+};
+
+//passes the bus on to a simulator and keeps the command bytes and counts the
+//data bytes sent since clear().
+class Tap : public SSD1306_Transport{
+public:
+	Tap(SSD1306_Sim* sim):m_pSim(sim){clear();}
+	virtual bool begin(){return m_pSim->begin();}
+	virtual void beginTransmission(unsigned char control){
+		m_command = control == SSD1306_CONTROL_CMD;
+		m_pSim->beginTransmission(control);
+	}
+	virtual void write(unsigned char b){
+		if(!m_command) dataBytes++;
+		else if(commandBytes < sizeof(commands)) commands[commandBytes++] = b;
+		m_pSim->write(b);
+	}
+	virtual void endTransmission(){m_pSim->endTransmission();}
+	void clear(){
+		commandBytes = 0;
+		dataBytes = 0;
+	}
+	//the command bytes since clear() are seq and nothing else.
+	bool sent(const unsigned char* seq, size_t n){
+		return commandBytes == n && memcmp(commands,seq,n) == 0;
+	}
+	unsigned char commands[64];
+	size_t commandBytes;
+	unsigned long dataBytes;
+private:
+	SSD1306_Sim* m_pSim;
+	bool m_command;
+};
+#define SENT(tap, ...) do{ \
+	const unsigned char seq[] = {__VA_ARGS__}; \
+	CHECK((tap).sent(seq,sizeof(seq))); \
+}while(0)
+
+//GDDRAM bytes that differ from the framebuffer of d, which holds the whole panel.
+template <class Panel>
+int ramMismatches(SSD1306_Sim& sim, Probe<Panel>& d)
+{
+	int bad = 0;
+	for(unsigned char m=0;m<d.pages();m++)
+	{
+		for(int16_t x=0;x<d.width();x++)
+		{
+			if(sim.ram(m,x+d.colOffset()) != d.fb(m,x)) bad++;
+		}
+	}
+	return bad;
+}
+
+//n random primitives, some of them across the panel edges.
+static inline void scribble(Adafruit_GFX& g, int n)
+{
+	int16_t w = g.width(), h = g.height();
+	while(n--)
+	{
+		int16_t x = rand()%(w+20)-10, y = rand()%(h+20)-10;
+		uint16_t color = rand()&1;
+		switch(rand()%5)
+		{
+		case 0:
+			g.drawPixel(x,y,color);
+			break;
+		case 1:
+			g.fillRect(x,y,rand()%40,rand()%30,color);
+			break;
+		case 2:
+			g.drawLine(x,y,rand()%w,rand()%h,color);
+			break;
+		case 3:
+			g.drawCircle(x,y,rand()%20,color);
+			break;
+		default:
+			g.drawChar(x,y,'0'+rand()%40,color,rand()&1 ? !color : color,1+rand()%2);
+			break;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,60 @@
+//the bus of SSD1306_BitBang, the pin writes of its digitalWrite() decoded by
+//SSD1306_Sim: edges, bytes and transactions of a full frame and of a status
+//screen where only the seconds tick.
+//   make -C test/host perf
+#include "host_test.h"
+
+#define SDA_PIN 4
+#define SCL_PIN 5
+
+static SSD1306_Sim* pSim = 0;
+
+static void simPin(uint8_t pin, uint8_t level)
+{
+	pSim->pinWrite(pin,level);
+}
+
+static void drawStatus(Adafruit_ssd1306syp& d, int seconds)
+{
+	d.setTextColor(WHITE,BLACK);
+	d.setCursor(0,0);
+	d.print("SSD1306 sim");
+	d.setCursor(0,55);
+	d.print("12:34:");
+	if(seconds<10) d.print('0');
+	d.print(seconds);
+}
+
+static void report(const char* name, SSD1306_Sim& s)
+{
+	printf("%s: %lu edges, %lu bytes, %lu transactions, %lu cmd/%lu data, %lu errors\n",
+		name,s.edges(),s.busBytes(),s.transactions(),s.commandBytes(),s.dataBytes(),s.errors());
+}
+
+int main()
+{
+	SSD1306_Sim sim(128,64,SDA_PIN,SCL_PIN);
+	pSim = &sim;
+	hostPinWrite = simPin;
+	SSD1306_BitBang bitbang(SDA_PIN,SCL_PIN);
+	Probe<Adafruit_ssd1306syp> display(&bitbang);
+
+	display.initialize();
+	drawStatus(display,56);
+	display.update();
+	report("init + first screen",sim);
+
+	sim.resetCounters();
+	display.invalidate();
+	display.update();
+	report("full frame",sim);
+
+	sim.resetCounters();
+	drawStatus(display,57);
+	display.update();
+	report("seconds tick",sim);
+
+	hostPinWrite = 0;
+	//the numbers are only worth something if the panel got the frame.
+	return ramMismatches(sim,display) == 0 && sim.errors() == 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+//SSD1306_GpioBitBang must put the same levels on the pins as SSD1306_BitBang,
+//only held for a different time. both run the same drawing with their pin
+//writes recorded, and decoded by the simulator.
+#include "host_test.h"
+#include <SSD1306_GpioBitBang.h>
+
+#define SDA_PIN 4
+#define SCL_PIN 5
+
+//the pin writes so far, counted and hashed (FNV-1a of pin<<1|level).
+struct Waveform{
+	unsigned long writes;
+	uint32_t hash;
+	bool operator==(const Waveform& o) const {return writes==o.writes && hash==o.hash;}
+};
+static Waveform levels;
+static SSD1306_Sim* pSim = 0;
+
+static void recordPin(uint8_t pin, uint8_t level)
+{
+	levels.writes++;
+	levels.hash = (levels.hash^((pin<<1)|(level ? 1 : 0)))*16777619u;
+	if(pSim) pSim->pinWrite(pin,level);
+}
+
+//the pin writes of initialize() and two frames, and the simulator they went to.
+template <class Panel>
+static Waveform capture(Probe<Panel>& d, SSD1306_Sim& sim)
+{
+	levels.writes = 0;
+	levels.hash = 2166136261u;
+	pSim = &sim;
+	hostPinWrite = recordPin;
+	d.initialize();
+	srand(5);
+	scribble(d,20);
+	d.update();
+	scribble(d,5);
+	d.update();
+	hostPinWrite = 0;
+	pSim = 0;
+	CHECK(ramMismatches(sim,d) == 0);
+	CHECK(sim.errors() == 0);
+	return levels;
+}
+
+static void testSameWaveform()
+{
+	SSD1306_Sim simBitBang(128,64,SDA_PIN,SCL_PIN);
+	SSD1306_BitBang bitbang(SDA_PIN,SCL_PIN);
+	Probe<Adafruit_ssd1306syp> reference(&bitbang);
+	Waveform expected = capture(reference,simBitBang);
+	CHECK(simBitBang.busBytes() > 1024);
+
+	unsigned long clocks[] = {0,SSD1306_I2C_FAST,SSD1306_I2C_STANDARD};
+	for(unsigned int i=0;i<sizeof(clocks)/sizeof(clocks[0]);i++)
+	{
+		SSD1306_Sim sim(128,64,SDA_PIN,SCL_PIN);
+		SSD1306_GpioBitBang gpio(SDA_PIN,SCL_PIN,clocks[i]);
+		Probe<Adafruit_ssd1306syp> d(&gpio);
+		CHECK(gpio.isDirect());
+		CHECK(capture(d,sim) == expected);
+		CHECK(sim.edges() == simBitBang.edges());
+		CHECK(sim.busBytes() == simBitBang.busBytes());
+	}
+}
+
+int main()
+{
+	RUN(testSameWaveform());
+	return finish();
+}
@@ -0,0 +1,231 @@
+//the fonts of Adafruit_GFX_AS: the page format tables of fontconv.py drawn
+//by the library, generic and on the SSD1306 panel, against the row format
+//fonts they were made from. built twice, with the full page format fonts
+//and with ones cut down to SUBSET_CHARS, whose other characters aren't drawn.
+#include "host_test.h"
+#include <SSD1306_GFX_AS.h>
+#include "Font16.h"
+#include "Font32.h"
+#include "Font64.h"
+#include "Font7s.h"
+#include "Font72.h"
+
+//Adafruit_GFX_AS with nothing but drawPixel().
+class Canvas : public Adafruit_GFX_AS{
+public:
+	Canvas():Adafruit_GFX_AS(128,64){memset(px,0,sizeof(px));}
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color){
+		if(x<0 || y<0 || x>=128 || y>=64) return;
+		px[y][x] = color ? 1 : 0;
+	}
+	unsigned char px[64][128];
+};
+
+//the row format fonts and their gaps, as fontGlyph() had them.
+struct RowFont{
+	int font;
+	const unsigned char* widths;
+	const unsigned char* const* glyphs;
+	unsigned int height;
+	int8_t gap;
+};
+static const RowFont rowFonts[] = {
+	{2,widtbl_f16,chrtbl_f16,chr_hgt_f16,1},
+	{4,widtbl_f32,chrtbl_f32,chr_hgt_f32,-3},
+	{6,widtbl_f64,chrtbl_f64,chr_hgt_f64,-3},
+	{7,widtbl_f7s,chrtbl_f7s,chr_hgt_f7s,2},
+	{8,widtbl_f72,chrtbl_f72,chr_hgt_f72,2}
+};
+#define FONTS 5
+
+//drawChar() of the row format fonts the way the library drew them before the
+//page format, a pixel or a size x size block per bit, opaque size 1 text
+//as the block write of whole glyph bytes. the reference of the others.
+class RowCanvas : public Canvas{
+public:
+	using Adafruit_GFX_AS::drawChar;
+	virtual int drawChar(unsigned int c, int x, int y, int font){
+		const RowFont* f = 0;
+		for(int i=0;i<FONTS;i++) if(rowFonts[i].font == font) f = &rowFonts[i];
+		if(f == 0 || c < 32 || c-32 >= 96) return 0;
+#ifdef SUBSET_CHARS
+		if(strchr(SUBSET_CHARS,c) == 0) return 0;
+#endif
+		const unsigned char* glyph = f->glyphs[c-32];
+		int width = f->widths[c-32], w = (width+7)/8, size = textsize;
+		int advance = (width+f->gap)*size;
+		//as unsigned as the library has it, a glyph ending left of the
+		//display is skipped too.
+		if((unsigned int)(x+advance) >= (unsigned int)_width) return advance;
+		bool opaque = textcolor != textbgcolor;
+		for(unsigned int row=0;row<f->height;row++)
+		{
+			if(opaque && size != 1) fillRect(x,y+row*size,advance,size,textbgcolor);
+			for(int k=0;k<w;k++)
+			{
+				unsigned char line = glyph[w*row+k];
+				for(int b=0;b<8;b++)
+				{
+					bool on = (line>>(7-b))&1;
+					if(size == 1){
+						if(on || opaque) drawPixel(x+k*8+b,y+row,on ? textcolor : textbgcolor);
+					}else if(on){
+						fillRect(x+(k*8+b)*size,y+row*size,size,size,textcolor);
+					}
+				}
+			}
+		}
+		return advance;
+	}
+};
+
+static const int fontNumbers[FONTS] = {2,4,6,7,8};
+
+//a random string, mostly printable characters of the fonts.
+static void randomString(char* s, int n)
+{
+	for(int i=0;i<n;i++)
+	{
+		switch(rand()%8)
+		{
+		case 0: s[i] = 1+rand()%255; break;
+		case 1: s[i] = "0123456789:.- "[rand()%14]; break;
+		default: s[i] = 32+rand()%96; break;
+		}
+	}
+	s[n] = 0;
+}
+
+//strings of the page format fonts are pixel for pixel those of the row
+//format ones, at sizes 1 to 3, opaque and transparent, over a random
+//picture and partly off the display.
+static void testRowsAndPages()
+{
+	Canvas pages;
+	RowCanvas rows;
+	int bad = 0, badWidths = 0;
+	char s[12], t[12];
+	srand(22);
+	for(int i=0;i<6000;i++)
+	{
+		for(int y=0;y<64;y++) for(int x=0;x<128;x++) pages.px[y][x] = rows.px[y][x] = rand()&1;
+		int font = fontNumbers[rand()%FONTS];
+		int x = rand()%150-20, y = rand()%90-30;
+		uint16_t color = rand()&1, bg = rand()%3 ? !color : color;
+		uint8_t size = rand()%4 ? 1 : 2+rand()%2;
+		randomString(s,1+rand()%10);
+		strcpy(t,s);//drawString() takes a char*
+		pages.setTextColor(color,bg);
+		rows.setTextColor(color,bg);
+		pages.setTextSize(size);
+		rows.setTextSize(size);
+		if(pages.drawString(s,x,y,font) != rows.drawString(t,x,y,font)) badWidths++;
+		if(memcmp(pages.px,rows.px,sizeof(pages.px)) != 0) bad++;
+	}
+	CHECK(bad == 0);
+	CHECK(badWidths == 0);
+}
+
+//every glyph of every font, run length coded or not, on and off the page
+//grid, at sizes 1 and 2 with and without a background. both encodings must
+//be in the run for the decoder of drawGlyphPages() to be checked.
+//the cut down fonts leave the characters they don't have out.
+static void testEveryGlyph()
+{
+	const FontPages* fonts[FONTS] = {&fontpages_f16,&fontpages_f32,&fontpages_f64,&fontpages_f7s,&fontpages_f72};
+	Canvas pages;
+	RowCanvas rows;
+	int bad = 0, coded = 0;
+	char s[2] = {0,0}, t[2] = {0,0};
+	for(int f=0;f<FONTS;f++)
+	{
+		if(fonts[f]->encoding == FONT_PAGES_RUNS) coded++;
+		for(int c=32;c<128;c++)
+		{
+			for(int k=0;k<8;k++)
+			{
+				uint16_t bg = k&1 ? BLACK : WHITE;
+				uint8_t size = k&2 ? 2 : 1;
+				int y = k&4 ? 3 : 0;
+				memset(pages.px,k&1,sizeof(pages.px));
+				memset(rows.px,k&1,sizeof(rows.px));
+				pages.setTextColor(WHITE,bg);
+				rows.setTextColor(WHITE,bg);
+				pages.setTextSize(size);
+				rows.setTextSize(size);
+				s[0] = t[0] = c;
+				pages.drawString(s,1,y,fontNumbers[f]);
+				rows.drawString(t,1,y,fontNumbers[f]);
+				if(memcmp(pages.px,rows.px,sizeof(pages.px)) != 0) bad++;
+			}
+		}
+	}
+	CHECK(bad == 0);
+#ifdef SUBSET_CHARS
+	//all run length coded (fontconv.py --encoding runs), with a map each.
+	CHECK(coded == FONTS);
+	for(int f=0;f<FONTS;f++) CHECK(fonts[f]->map != 0);
+#else
+	CHECK(coded > 0 && coded < FONTS);
+#endif
+}
+
+static bool panelPixel(Probe<Adafruit_ssd1306syp>& d, int16_t x, int16_t y){return (d.fb(y>>3,x)>>(y&7))&1;}
+
+//SSD1306_GFX_AS writes the glyphs a page byte at a time (drawPageBitmap())
+//and the block writes eight pixels at a time (drawBits()), the pixels are
+//those the generic code draws through drawPixel().
+static void testPanelSink()
+{
+	Probe<Adafruit_ssd1306syp> d(0);
+	SSD1306_GFX_AS panel(d);
+	Canvas generic;
+	int bad = 0;
+	char s[12], t[12];
+	srand(23);
+	for(int i=0;i<6000;i++)
+	{
+		for(int y=0;y<64;y++) for(int x=0;x<128;x++)
+		{
+			generic.px[y][x] = rand()&1;
+			d.drawPixel(x,y,generic.px[y][x]);
+		}
+		uint16_t color = rand()&1, bg = rand()%3 ? !color : color;
+		int x = rand()%150-20, y = rand()%90-30;
+		panel.setTextColor(color,bg);
+		generic.setTextColor(color,bg);
+		if(rand()%4){
+			int font = fontNumbers[rand()%FONTS];
+			uint8_t size = rand()%4 ? 1 : 2;
+			randomString(s,1+rand()%10);
+			strcpy(t,s);
+			panel.setTextSize(size);
+			generic.setTextSize(size);
+			panel.drawString(s,x,y,font);
+			generic.drawString(t,x,y,font);
+		}else{
+			//a window of random bits, pushed in random counts.
+			int16_t x1 = x+rand()%40, y1 = y+rand()%20;
+			panel.setAddrWindow(x,y,x1,y1);
+			generic.setAddrWindow(x,y,x1,y1);
+			for(int n=(x1-x+1)*(y1-y+1);n>0;)
+			{
+				uint8_t bits = rand(), count = 1+rand()%8;
+				if(count > n) count = n;
+				panel.pushBits(bits,count,color,bg);
+				generic.pushBits(bits,count,color,bg);
+				n -= count;
+			}
+		}
+		for(int y=0;y<64;y++) for(int x=0;x<128;x++) if(panelPixel(d,x,y) != generic.px[y][x]) bad++;
+	}
+	CHECK(bad == 0);
+}
+
+int main()
+{
+	RUN(testRowsAndPages());
+	RUN(testEveryGlyph());
+	RUN(testPanelSink());
+	return finish();
+}
@@ -0,0 +1,300 @@
+//the drawing code without a bus: the primitives, clipping and the widgets.
+#include "host_test.h"
+#include <Adafruit_GFX_Widgets.h>
+
+//Adafruit_GFX with nothing but drawPixel(), the generic code paths.
+class Pixels : public Adafruit_GFX{
+public:
+	Pixels():Adafruit_GFX(128,64){memset(px,0,sizeof(px));}
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color){
+		if(x<0 || y<0 || x>=128 || y>=64) return;
+		px[y][x] = color ? 1 : 0;
+	}
+	bool pixel(int16_t x, int16_t y){return px[y][x];}
+	unsigned char px[64][128];
+};
+
+//a round rect drawn inside a clip rectangle is the unclipped one cut to it,
+//whatever the radius.
+template <class Display>
+static void roundRects(Display& full, Display& clipped, int n,
+	bool (*get)(Display&, int16_t, int16_t))
+{
+	int bad = 0;
+	srand(6);
+	while(n--)
+	{
+		int16_t x = rand()%150-10, y = rand()%80-10;
+		int16_t w = rand()%40, h = rand()%30, r = rand()%30-3;
+		int16_t cx = rand()%128, cy = rand()%64, cw = rand()%60, ch = rand()%40;
+		full.fillScreen(BLACK);
+		clipped.fillScreen(BLACK);
+		if(rand()&1){
+			full.fillRoundRect(x,y,w,h,r,WHITE);
+			clipped.pushClip(cx,cy,cw,ch);
+			clipped.fillRoundRect(x,y,w,h,r,WHITE);
+		}else{
+			full.drawRoundRect(x,y,w,h,r,WHITE);
+			clipped.pushClip(cx,cy,cw,ch);
+			clipped.drawRoundRect(x,y,w,h,r,WHITE);
+		}
+		clipped.popClip();
+		for(int16_t py=0;py<64;py++)
+		{
+			for(int16_t px=0;px<128;px++)
+			{
+				bool in = px>=cx && px<cx+cw && py>=cy && py<cy+ch;
+				if(get(clipped,px,py) != (in && get(full,px,py))) bad++;
+			}
+		}
+	}
+	CHECK(bad == 0);
+}
+static bool panelPixel(Probe<Adafruit_ssd1306syp>& d, int16_t x, int16_t y){return (d.fb(y>>3,x)>>(y&7))&1;}
+static bool genericPixel(Pixels& d, int16_t x, int16_t y){return d.pixel(x,y);}
+
+//Adafruit_GFX with nothing but drawPixel() that remembers which pixels a
+//primitive wrote and to what, for drawing the reference of a panel primitive.
+class Strokes : public Adafruit_GFX{
+public:
+	Strokes():Adafruit_GFX(128,64){clear();}
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color){
+		if(x<0 || y<0 || x>=128 || y>=64) return;
+		px[y][x] = color ? 1 : 0;
+	}
+	void clear(){memset(px,UNTOUCHED,sizeof(px));}
+	enum{UNTOUCHED = 2};
+	unsigned char px[64][128];
+};
+
+//the dirty span of each page of d covers the bytes that differ from before
+//and no more.
+static bool dirtyIsChange(Probe<Adafruit_ssd1306syp>& d, unsigned char before[8][128])
+{
+	for(unsigned char m=0;m<8;m++)
+	{
+		int lo = 0xFF, hi = 0;
+		for(int x=0;x<128;x++)
+		{
+			if(d.fb(m,x) == before[m][x]) continue;
+			if(lo == 0xFF) lo = x;
+			hi = x;
+		}
+		if(d.dirtyLo(m) != lo || d.dirtyHi(m) != hi) return false;
+	}
+	return true;
+}
+
+//one random primitive, the same call on the panel and on the reference.
+template <class Display>
+static void drawRandom(Display& g, int kind, const int16_t* a, uint16_t color)
+{
+	switch(kind)
+	{
+	case 0: g.drawLine(a[0],a[1],a[2],a[3],color); break;
+	case 1: g.drawCircle(a[0],a[1],a[6]%40,color); break;
+	case 2: g.fillCircle(a[0],a[1],a[6]%40,color); break;
+	case 3: g.drawTriangle(a[0],a[1],a[2],a[3],a[4],a[5],color); break;
+	case 4: g.fillTriangle(a[0],a[1],a[2],a[3],a[4],a[5],color); break;
+	case 5: g.drawRoundRect(a[0],a[1],a[6]%90,a[7]%70,a[8]%30-3,color); break;
+	case 6: g.fillRoundRect(a[0],a[1],a[6]%90,a[7]%70,a[8]%30-3,color); break;
+	case 7: g.drawSpan(a[1],a[0],a[0]+a[6]%90,color); break;
+	//at least 1 wide and high, Adafruit_GFX draws the lines of the others
+	//backwards where the panel draws nothing.
+	case 8: g.drawFastHLine(a[0],a[1],1+a[6]%150,color); break;
+	case 9: g.drawFastVLine(a[0],a[1],1+a[7]%80,color); break;
+	case 10: g.drawRect(a[0],a[1],a[6]%90,a[7]%70,color); break;
+	case 11: g.fillRect(a[0],a[1],1+a[6]%90,1+a[7]%70,color); break;
+	//glyphs with a background or transparent, any character, sizes 1 to 9.
+	case 12: g.drawChar(a[0],a[1],a[6]*7+a[7],color,a[8]&1 ? !color : color,1+(a[8]>>1)%9); break;
+	default:
+		{
+			const uint8_t chars[] = {(uint8_t)a[6],(uint8_t)a[7],'0','g',(uint8_t)a[8]};
+			g.drawChars(a[0],a[1],chars,a[8]%6,color,a[8]&1 ? !color : color,1+a[7]%9);
+		}
+		break;
+	}
+}
+#define PRIMITIVES 14
+
+//each primitive of the panel (Adafruit_GFX_Raster<SSD1306_Panel>, page
+//bytes) leaves the pixels Adafruit_GFX draws through drawPixel() and nothing
+//else changed, and the dirty span of each page is exactly the bytes that
+//changed. inside up to three nested clip rectangles the panel draws what
+//Adafruit_GFX draws unclipped, cut to all of them.
+static void testPrimitives()
+{
+	Probe<Adafruit_ssd1306syp> d(0);
+	Strokes ref;
+	int bad = 0, badSpans = 0;
+	unsigned char before[8][128];
+	srand(12);
+	scribble(d,40);
+	for(int i=0;i<40000;i++)
+	{
+		int16_t a[9];
+		for(int k=0;k<6;k++) a[k] = rand()%(k&1 ? 100 : 170)-(k&1 ? 18 : 21);
+		for(int k=6;k<9;k++) a[k] = rand()%200;
+		int kind = rand()%PRIMITIVES;
+		uint16_t color = rand()&1;
+		for(int m=0;m<8;m++) for(int16_t x=0;x<128;x++) before[m][x] = d.fb(m,x);
+		ref.clear();
+		d.markAllClean();
+		int16_t cx0 = 0, cy0 = 0, cx1 = 127, cy1 = 63;
+		int clips = rand()%4;
+		for(int k=0;k<clips;k++)
+		{
+			int16_t x = rand()%140-6, y = rand()%76-6, w = rand()%130, h = rand()%70;
+			CHECK(d.pushClip(x,y,w,h));
+			if(x > cx0) cx0 = x;
+			if(y > cy0) cy0 = y;
+			if(x+w-1 < cx1) cx1 = x+w-1;
+			if(y+h-1 < cy1) cy1 = y+h-1;
+		}
+		drawRandom(d,kind,a,color);
+		drawRandom(ref,kind,a,color);
+		while(clips--) d.popClip();
+		for(int16_t y=0;y<64;y++)
+		{
+			for(int16_t x=0;x<128;x++)
+			{
+				bool was = (before[y>>3][x]>>(y&7))&1;
+				bool in = x>=cx0 && x<=cx1 && y>=cy0 && y<=cy1;
+				bool want = !in || ref.px[y][x] == Strokes::UNTOUCHED ? was : ref.px[y][x];
+				if(panelPixel(d,x,y) != want) bad++;
+			}
+		}
+		if(!dirtyIsChange(d,before)) badSpans++;
+	}
+	CHECK(bad == 0);
+	CHECK(badSpans == 0);
+	//all popped, the whole panel again.
+	d.fillScreen(WHITE);
+	for(int m=0;m<8;m++) for(int16_t x=0;x<128;x++) if(d.fb(m,x) != 0xFF) bad++;
+	CHECK(bad == 0);
+}
+
+
+static void testRoundRectClip()
+{
+	Probe<Adafruit_ssd1306syp> full(0), clipped(0);
+	roundRects(full,clipped,5000,panelPixel);
+	Pixels genericFull, genericClipped;
+	roundRects(genericFull,genericClipped,5000,genericPixel);
+}
+
+//a number that doesn't fit its cells is never shown cut short.
+static void testValueOverflow()
+{
+	GFX_Value right(0,0,3), left(0,8,3,1,WHITE,BLACK,true);
+	right.setValue(7);
+	CHECK(strcmp(right.text(),"  7") == 0);
+	right.setValue(-12);
+	CHECK(strcmp(right.text(),"-12") == 0);
+	right.setValue(999);
+	CHECK(strcmp(right.text(),"999") == 0);
+	right.setValue(12345);
+	CHECK(strcmp(right.text(),"***") == 0);
+	right.setValue(-1234);
+	CHECK(strcmp(right.text(),"***") == 0);
+	right.setValue(-100);
+	CHECK(strcmp(right.text(),"***") == 0);
+	right.setValue(5);
+	CHECK(strcmp(right.text(),"  5") == 0);
+	left.setValue(7);
+	CHECK(strcmp(left.text(),"7") == 0);
+	left.setValue(1000);
+	CHECK(strcmp(left.text(),"***") == 0);
+}
+
+//random text of a few characters, runs of it often come out the same.
+static void randomText(char* text, int n)
+{
+	static const char chars[] = " ab1-";
+	for(int i=0;i<n;i++) text[i] = chars[rand()%5];
+	text[n] = 0;
+}
+static bool sameFramebuffer(Probe<Adafruit_ssd1306syp>& a, Probe<Adafruit_ssd1306syp>& b)
+{
+	for(int m=0;m<8;m++) for(int16_t x=0;x<128;x++) if(a.fb(m,x) != b.fb(m,x)) return false;
+	return true;
+}
+
+//a screen of widgets that only draws what changed shows the same as the
+//widgets built afresh and drawn whole on a cleared panel.
+static void testWidgets()
+{
+	Probe<Adafruit_ssd1306syp> d(0), ref(0);
+	GFX_Text text(0,0,21);
+	GFX_Value value(0,16,5,2), count(0,40,6,1,WHITE,BLACK,true);
+	GFX_Icon icon(100,40,16,16);
+	GFX_Screen screen;
+	uint8_t bitmaps[2][32];
+	const uint8_t* bitmap = 0;
+	char buf[32];
+	int bad = 0, redrawn = 0;
+	srand(19);
+	for(int i=0;i<64;i++) bitmaps[i/32][i%32] = rand();
+	CHECK(screen.add(text));
+	CHECK(screen.add(value));
+	CHECK(screen.add(count));
+	CHECK(screen.add(icon));
+	value.setValue(0);
+	count.setValue(0);
+	d.fillScreen(BLACK);
+	for(int i=0;i<20000;i++)
+	{
+		switch(rand()%5)
+		{
+		case 0:
+			randomText(buf,rand()%24);
+			text.setText(buf);
+			break;
+		case 1:
+			value.setValue(rand()%3 ? rand()%2000-1000 : rand()%200000-100000);
+			break;
+		case 2:
+			count.setValue(rand()%3 ? rand()%100 : rand()%20000000-10000000);
+			break;
+		case 3:
+			bitmap = rand()%3 ? bitmaps[rand()&1] : 0;
+			icon.setBitmap(bitmap);
+			break;
+		default:
+			//the display was cleared behind the widgets.
+			d.fillScreen(BLACK);
+			screen.invalidate();
+			break;
+		}
+		screen.draw(d);
+		//a setter that changes nothing doesn't draw.
+		text.setText(text.text());
+		value.setValue(value.value());
+		icon.setBitmap(bitmap);
+		redrawn += screen.draw(d);
+
+		GFX_Text freshText(0,0,21);
+		GFX_Value freshValue(0,16,5,2), freshCount(0,40,6,1,WHITE,BLACK,true);
+		GFX_Icon freshIcon(100,40,16,16,bitmap);
+		freshText.setText(text.text());
+		freshValue.setValue(value.value());
+		freshCount.setValue(count.value());
+		ref.fillScreen(BLACK);
+		freshText.draw(ref);
+		freshValue.draw(ref);
+		freshCount.draw(ref);
+		freshIcon.draw(ref);
+		if(!sameFramebuffer(d,ref)) bad++;
+	}
+	CHECK(bad == 0);
+	CHECK(redrawn == 0);
+}
+
+int main()
+{
+	RUN(testPrimitives());
+	RUN(testRoundRectClip());
+	RUN(testValueOverflow());
+	RUN(testWidgets());
+	return finish();
+}
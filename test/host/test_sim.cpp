@@ -0,0 +1,378 @@
+//the display code against the simulated controller: whatever path the
+//framebuffer takes to the panel, GDDRAM must end up equal to it.
+#include "host_test.h"
+
+//GDDRAM full of a pattern, e.g. what a previous sketch left there.
+static void fillRam(SSD1306_Sim& sim, unsigned char pattern)
+{
+	const unsigned char window[] = {0x20,0x00,0x21,0,127,0x22,0,7};
+	sim.beginTransmission(SSD1306_CONTROL_CMD);
+	for(unsigned int i=0;i<sizeof(window);i++) sim.write(window[i]);
+	sim.endTransmission();
+	sim.beginTransmission(SSD1306_CONTROL_DATA);
+	for(int i=0;i<SSD1306_SIM_PAGES*SSD1306_SIM_COLUMNS;i++) sim.write(pattern);
+	sim.endTransmission();
+}
+
+static void testInitialize()
+{
+	SSD1306_Sim sim;
+	Probe<Adafruit_ssd1306syp> d(&sim);
+	fillRam(sim,0xA5);
+	sim.reset();
+	sim.resetCounters();
+	CHECK(d.initialize());
+	CHECK(sim.isOn());
+	CHECK(sim.memoryMode() == 0x00);
+	CHECK(sim.errors() == 0);
+	d.update();
+	CHECK(ramMismatches(sim,d) == 0);
+}
+
+template <class Panel>
+static void testUpdate(unsigned char mode)
+{
+	SSD1306_Sim sim(Panel::Width,Panel::Height);
+	Probe<Panel> d(&sim);
+	d.initialize();
+	d.setUpdateMode(mode);
+	fillRam(sim,0x3C);
+	d.invalidate();
+	srand(1);
+	for(int i=0;i<100;i++)
+	{
+		scribble(d,1+rand()%8);
+		d.update();
+		CHECK(ramMismatches(sim,d) == 0);
+	}
+	CHECK(sim.errors() == 0);
+}
+
+static void testUpdateRow()
+{
+	SSD1306_Sim sim;
+	Probe<Adafruit_ssd1306syp> d(&sim);
+	d.initialize();
+	d.update();
+	srand(2);
+	for(int i=0;i<20;i++)
+	{
+		scribble(d,10);
+		for(int m=0;m<8;m++) d.updateRow(m);
+		CHECK(ramMismatches(sim,d) == 0);
+		scribble(d,10);
+		d.updateRow(0,8);
+		CHECK(ramMismatches(sim,d) == 0);
+	}
+	//what updateRow() sent is clean, update() only sends the rest.
+	d.fillRect(0,0,128,64,WHITE);
+	d.updateRow(0,4);
+	sim.resetCounters();
+	d.update();
+	CHECK(sim.dataBytes() == 4*128);
+	CHECK(ramMismatches(sim,d) == 0);
+	CHECK(sim.errors() == 0);
+}
+
+//a full frame is the 1024 GDDRAM bytes, a tick of the seconds of a clock
+//line only the columns of the digit that changed.
+static void testClockTick()
+{
+	SSD1306_Sim sim;
+	Probe<Adafruit_ssd1306syp> d(&sim);
+	d.initialize();
+	d.fillRect(0,0,128,64,WHITE);
+	sim.resetCounters();
+	d.invalidate();
+	d.update();
+	CHECK(sim.dataBytes() == 128*8);
+	CHECK(sim.transactions() == 2);
+
+	d.clear(true);
+	d.setTextColor(WHITE,BLACK);
+	d.setCursor(0,55);
+	d.print("12:34:56");
+	d.update();
+	//6 to 7: the five glyph columns on pages 6 and 7, the blank sixth stays.
+	sim.resetCounters();
+	d.setCursor(6*7,55);
+	d.print('7');
+	d.update();
+	CHECK(sim.dataBytes() == 5*2);
+	CHECK(sim.transactions() == 2);
+	CHECK(ramMismatches(sim,d) == 0);
+	for(int i=0;i<10;i++)
+	{
+		sim.resetCounters();
+		d.setCursor(6*7,55);
+		d.print(i);
+		d.update();
+		CHECK(sim.dataBytes() <= 5*2);
+		CHECK(ramMismatches(sim,d) == 0);
+	}
+	CHECK(sim.errors() == 0);
+}
+
+static void testPoll()
+{
+	SSD1306_Sim sim;
+	Probe<Adafruit_ssd1306syp> d(&sim);
+	d.initialize();
+	srand(3);
+	for(int i=0;i<50;i++)
+	{
+		int more = 3;
+		scribble(d,10);
+		d.beginUpdate();
+		while(d.isBusy())
+		{
+			CHECK(d.poll(7) <= 7);
+			//drawing while busy goes out with the next flush.
+			if(more && rand()%8 == 0){
+				more--;
+				scribble(d,2);
+				d.beginUpdate();
+			}
+		}
+		d.update();
+		CHECK(ramMismatches(sim,d) == 0);
+	}
+	//an idle poll() from loop() doesn't even read the clock.
+	unsigned long calls = hostMicrosCalls;
+	CHECK(d.poll() == 0);
+	CHECK(d.poll(SSD1306_POLL_BYTES,1000) == 0);
+	CHECK(hostMicrosCalls == calls);
+	CHECK(sim.errors() == 0);
+}
+
+//update() addresses the dirty box with one column/page window, or one
+//window per page, shifted by the column offset of narrow panels.
+static void testWindow()
+{
+	SSD1306_Sim sim;
+	Tap tap(&sim);
+	Probe<Adafruit_ssd1306syp> d(&tap);
+	d.initialize();
+	d.update();
+
+	tap.clear();
+	d.drawPixel(10,20,WHITE);
+	d.update();
+	SENT(tap,0x21,10,10,0x22,2,2);
+	CHECK(tap.dataBytes == 1);
+	CHECK(sim.ram(2,10) == 0x10);
+
+	tap.clear();
+	d.drawPixel(5,3,WHITE);
+	d.drawPixel(40,30,WHITE);
+	d.update();
+	SENT(tap,0x21,5,40,0x22,0,3);
+	CHECK(tap.dataBytes == 4*36);
+	CHECK(ramMismatches(sim,d) == 0);
+
+	d.setUpdateMode(SSD1306_UPDATE_PAGES);
+	tap.clear();
+	d.drawPixel(5,3,BLACK);
+	d.drawPixel(40,30,BLACK);
+	d.update();
+	SENT(tap,0x21,5,5,0x22,0,0,0x21,40,40,0x22,3,3);
+	CHECK(tap.dataBytes == 2);
+	CHECK(ramMismatches(sim,d) == 0);
+
+	tap.clear();
+	d.updateRow(7);
+	SENT(tap,0x21,0,127,0x22,7,7);
+	CHECK(tap.dataBytes == 128);
+	CHECK(sim.errors() == 0);
+}
+static void testNarrowWindow()
+{
+	SSD1306_Sim sim(64,48), sim32(128,32);
+	Tap tap(&sim), tap32(&sim32);
+	Probe<SSD1306_64x48> d(&tap);
+	Probe<SSD1306_128x32> d32(&tap32);
+	d.initialize();
+	d.update();
+	d32.initialize();
+	d32.update();
+	CHECK(d.colOffset() == 32);
+	CHECK(d32.colOffset() == 0);
+
+	//the 64 columns of the panel are GDDRAM columns 32..95.
+	tap.clear();
+	d.drawPixel(0,0,WHITE);
+	d.drawPixel(63,47,WHITE);
+	d.update();
+	SENT(tap,0x21,32,95,0x22,0,5);
+	CHECK(tap.dataBytes == 64*6);
+	CHECK(sim.ram(0,32) == 0x01);
+	CHECK(sim.ram(5,95) == 0x80);
+	CHECK(ramMismatches(sim,d) == 0);
+
+	tap.clear();
+	d.fillRect(10,12,4,2,WHITE);
+	d.update();
+	SENT(tap,0x21,42,45,0x22,1,1);
+	CHECK(ramMismatches(sim,d) == 0);
+
+	tap.clear();
+	d.updateRow(0,6);
+	SENT(tap,0x21,32,95,0x22,0,5);
+	CHECK(tap.dataBytes == 64*6);
+
+	tap32.clear();
+	d32.drawPixel(127,31,WHITE);
+	d32.update();
+	SENT(tap32,0x21,127,127,0x22,3,3);
+	CHECK(ramMismatches(sim32,d32) == 0);
+	CHECK(sim.errors() == 0 && sim32.errors() == 0);
+}
+
+//the scroll setups as the datasheet lists them, each one after a deactivate.
+static void testScroll()
+{
+	SSD1306_Sim sim;
+	Tap tap(&sim);
+	Probe<Adafruit_ssd1306syp> d(&tap);
+	d.initialize();
+	srand(4);
+	scribble(d,30);
+	d.update();
+
+	tap.clear();
+	d.startscrollright(1,3,SSD1306_SCROLL_2FRAMES);
+	SENT(tap,0x2E,0x26,0x00,1,0x07,3,0x00,0xFF,0x2F);
+	CHECK(sim.isScrolling());
+
+	//pages past the panel are the last one, start can't be past stop.
+	tap.clear();
+	d.startscrollleft(0,20);
+	SENT(tap,0x2E,0x27,0x00,0,0x00,7,0x00,0xFF,0x2F);
+	tap.clear();
+	d.startscrollleft(5,2,SSD1306_SCROLL_256FRAMES);
+	SENT(tap,0x2E,0x27,0x00,2,0x03,2,0x00,0xFF,0x2F);
+
+	tap.clear();
+	d.setScrollArea(8,40);
+	d.startscrolldiagright(0,7,2,SSD1306_SCROLL_4FRAMES);
+	SENT(tap,0x2E,0xA3,8,40,0x29,0x00,0,0x05,7,2,0x2F);
+
+	//the area is cut to the panel, the offset to the area.
+	tap.clear();
+	d.setScrollArea(60,20);
+	d.startscrolldiagleft(1,2,9);
+	SENT(tap,0x2E,0xA3,60,4,0x2A,0x00,1,0x00,2,3,0x2F);
+	CHECK(sim.isScrolling());
+
+	tap.clear();
+	d.setStartLine(70);
+	SENT(tap,0x46);
+
+	tap.clear();
+	d.stopscroll();
+	SENT(tap,0x2E);
+	CHECK(!sim.isScrolling());
+	CHECK(sim.errors() == 0);
+
+	//the scroll left GDDRAM shifted, all of the framebuffer goes out again.
+	fillRam(sim,0x99);
+	tap.clear();
+	d.update();
+	SENT(tap,0x21,0,127,0x22,0,7);
+	CHECK(tap.dataBytes == 1024);
+	CHECK(ramMismatches(sim,d) == 0);
+	CHECK(sim.errors() == 0);
+}
+
+struct Picture{
+	Adafruit_GFX* gfx;
+	unsigned int seed;
+};
+static void drawPicture(void* arg)
+{
+	Picture* p = (Picture*)arg;
+	srand(p->seed);
+	scribble(*p->gfx,30);
+}
+//render() of any band size must leave what a full framebuffer holds.
+template <class Panel>
+static void testRender()
+{
+	SSD1306_Sim sim, none;
+	Panel d(&sim);
+	Probe<Adafruit_ssd1306syp> ref(&none);
+	d.initialize();
+	ref.initialize();
+	fillRam(sim,0xFF);
+	for(unsigned int seed=1;seed<40;seed++)
+	{
+		//the same picture twice in a row now and then, it isn't sent again.
+		Picture p = {&d,seed/2};
+		d.render(drawPicture,&p);
+		ref.fillScreen(BLACK);
+		Picture r = {&ref,seed/2};
+		drawPicture(&r);
+		CHECK(ramMismatches(sim,ref) == 0);
+	}
+	CHECK(sim.errors() == 0);
+}
+//whatever went out between two render()s of the same picture, the second one
+//puts it back.
+static void testRenderAfterUpdate()
+{
+	SSD1306_Sim sim;
+	Tap tap(&sim);
+	Probe<Adafruit_ssd1306syp> d(&tap);
+	Picture p = {&d,7};
+	unsigned char way;
+	d.initialize();
+	for(way=0;way<5;way++)
+	{
+		d.render(drawPicture,&p);
+		CHECK(ramMismatches(sim,d) == 0);
+		d.fillScreen(BLACK);
+		d.fillRect(10,3,90,50,WHITE);
+		switch(way)
+		{
+		case 0: d.update(); break;
+		case 1: d.updateRow(2); break;
+		case 2: d.updateRow(1,5); break;
+		case 3:
+			d.beginUpdate();
+			while(d.isBusy()) d.poll(16);
+			break;
+		case 4: d.clear(true); break;
+		}
+		d.render(drawPicture,&p);
+		CHECK(ramMismatches(sim,d) == 0);
+	}
+	//a scroll moves GDDRAM, the next render() sends every page.
+	d.startscrollright(0,7);
+	tap.clear();
+	d.render(drawPicture,&p);
+	CHECK(tap.dataBytes == 128*8);
+	//and with nothing in between, none.
+	tap.clear();
+	d.render(drawPicture,&p);
+	CHECK(tap.dataBytes == 0);
+	CHECK(sim.errors() == 0);
+}
+
+int main()
+{
+	RUN(testInitialize());
+	RUN(testUpdate<Adafruit_ssd1306syp>(SSD1306_UPDATE_WINDOW));
+	RUN(testUpdate<Adafruit_ssd1306syp>(SSD1306_UPDATE_PAGES));
+	RUN(testUpdate<SSD1306_128x32>(SSD1306_UPDATE_WINDOW));
+	RUN(testUpdate<SSD1306_64x48>(SSD1306_UPDATE_PAGES));
+	RUN(testUpdateRow());
+	RUN(testClockTick());
+	RUN(testWindow());
+	RUN(testNarrowWindow());
+	RUN(testScroll());
+	RUN(testPoll());
+	RUN(testRender<Adafruit_ssd1306syp>());
+	RUN(testRender<SSD1306_128x64_Paged>());
+	RUN(testRenderAfterUpdate());
+	return finish();
+}